@@ -72,6 +72,10 @@ MenuItem.prototype.getCheckStatus = function () {
   return roles.getCheckStatus(this.role);
 };
 
+MenuItem.prototype.hasDynamicCheckStatus = function () {
+  return roles.shouldOverrideCheckStatus(this.role);
+};
+
 MenuItem.prototype.overrideProperty = function (name: string, defaultValue: any = null) {
   if (this[name] == null) {
     this[name] = defaultValue;
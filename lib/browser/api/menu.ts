@@ -8,6 +8,57 @@ const { Menu } = bindings as { Menu: typeof MenuType };
 let applicationMenu: MenuType | null = null;
 let groupIdIndex = 0;
 
+// The native menu model answers state queries (checked, enabled, visible,
+// accelerators) from a copy of the item state, which is pushed to every menu
+// holding an item whenever one of these properties changes. Items only hold
+// their menus weakly, so that an item does not keep every menu it was ever
+// inserted into alive.
+const trackedItemProperties = ['checked', 'enabled', 'visible', 'acceleratorWorksWhenHidden', 'registerAccelerator'];
+const menusForItem = new WeakMap<MenuItem, WeakRef<MenuType>[]>();
+const trackedSetters = new WeakSet<Function>();
+
+function pushItemState (item: MenuItem, changes: Record<string, any>) {
+  const menus = menusForItem.get(item);
+  if (!menus) return;
+  const liveMenus = menus.filter(ref => {
+    const menu = ref.deref();
+    if (menu) menu._setItemState(item.commandId, changes);
+    return menu !== undefined;
+  });
+  menusForItem.set(item, liveMenus);
+}
+
+function trackItemState (menu: MenuType, item: MenuItem) {
+  const menus = (menusForItem.get(item) || []).filter(ref => ref.deref() !== undefined);
+  if (!menus.some(ref => ref.deref() === menu)) menus.push(new WeakRef(menu));
+  menusForItem.set(item, menus);
+
+  for (const name of trackedItemProperties) {
+    const descriptor = Object.getOwnPropertyDescriptor(item, name)!;
+    if (descriptor.set && trackedSetters.has(descriptor.set)) continue;
+    let value = descriptor.value;
+    const get = descriptor.get || (() => value);
+    const set = descriptor.set || ((newValue: any) => { value = newValue; });
+    const trackedSet = (newValue: any) => {
+      set(newValue);
+      pushItemState(item, { [name]: (item as any)[name] });
+    };
+    trackedSetters.add(trackedSet);
+    Object.defineProperty(item, name, { enumerable: true, configurable: true, get, set: trackedSet });
+  }
+
+  menu._setItemState(item.commandId, {
+    checked: item.checked,
+    dynamicChecked: item.hasDynamicCheckStatus(),
+    enabled: item.enabled,
+    visible: item.visible,
+    acceleratorWorksWhenHidden: !!item.acceleratorWorksWhenHidden,
+    registerAccelerator: item.registerAccelerator,
+    accelerator: item.accelerator,
+    defaultAccelerator: item.getDefaultRoleAccelerator()
+  });
+}
+
 /* Instance Methods */
 
 Menu.prototype._init = function () {
@@ -22,27 +73,6 @@ Menu.prototype._isCommandIdChecked = function (id) {
   return item.getCheckStatus();
 };
 
-Menu.prototype._isCommandIdEnabled = function (id) {
-  return this.commandsMap[id] ? this.commandsMap[id].enabled : false;
-};
-Menu.prototype._shouldCommandIdWorkWhenHidden = function (id) {
-  return this.commandsMap[id] ? !!this.commandsMap[id].acceleratorWorksWhenHidden : false;
-};
-Menu.prototype._isCommandIdVisible = function (id) {
-  return this.commandsMap[id] ? this.commandsMap[id].visible : false;
-};
-
-Menu.prototype._getAcceleratorForCommandId = function (id, useDefaultAccelerator) {
-  const command = this.commandsMap[id];
-  if (!command) return;
-  if (command.accelerator != null) return command.accelerator;
-  if (useDefaultAccelerator) return command.getDefaultRoleAccelerator();
-};
-
-Menu.prototype._shouldRegisterAcceleratorForCommandId = function (id) {
-  return this.commandsMap[id] ? this.commandsMap[id].registerAccelerator : false;
-};
-
 if (process.platform === 'darwin') {
   Menu.prototype._getSharingItemForCommandId = function (id) {
     return this.commandsMap[id] ? this.commandsMap[id].sharingItem : null;
@@ -60,7 +90,10 @@ Menu.prototype._menuWillShow = function () {
   // Ensure radio groups have at least one menu item selected
   for (const id of Object.keys(this.groupsMap)) {
     const found = this.groupsMap[id].find(item => item.checked) || null;
-    if (!found) v8Util.setHiddenValue(this.groupsMap[id][0], 'checked', true);
+    if (!found) {
+      v8Util.setHiddenValue(this.groupsMap[id][0], 'checked', true);
+      pushItemState(this.groupsMap[id][0], { checked: true });
+    }
   }
 };
 
@@ -147,6 +180,7 @@ Menu.prototype.insert = function (pos, item) {
   // Remember the items.
   this.items.splice(pos, 0, item);
   this.commandsMap[item.commandId] = item;
+  trackItemState(this, item);
 };
 
 Menu.prototype._callMenuWillShow = function () {
@@ -281,7 +315,10 @@ function insertItemByType (this: MenuType, item: MenuItem, pos: number) {
         get: () => v8Util.getHiddenValue(item, 'checked'),
         set: () => {
           this.groupsMap[item.groupId].forEach(other => {
-            if (other !== item) v8Util.setHiddenValue(other, 'checked', false);
+            if (other !== item) {
+              v8Util.setHiddenValue(other, 'checked', false);
+              pushItemState(other, { checked: false });
+            }
           });
           v8Util.setHiddenValue(item, 'checked', true);
         }
@@ -1,7 +1,8 @@
-const { fromPartition } = process._linkedBinding('electron_browser_session');
+const { fromPartition, fromPartitionAsync } = process._linkedBinding('electron_browser_session');
 
 export default {
   fromPartition,
+  fromPartitionAsync,
   get defaultSession () {
     return fromPartition('');
   }
@@ -237,6 +237,15 @@ WebContents.prototype.printToPDF = async function (options) {
     printSettings.shouldPrintBackgrounds = options.printBackground;
   }
 
+  let outputPath: string | undefined;
+  if (options.path !== undefined) {
+    if (typeof options.path !== 'string' || options.path.length === 0) {
+      const error = new Error('path must be a non-empty String');
+      return Promise.reject(error);
+    }
+    outputPath = options.path;
+  }
+
   if (options.pageRanges !== undefined) {
     const pageRanges = options.pageRanges;
     if (!Object.prototype.hasOwnProperty.call(pageRanges, 'from') || !Object.prototype.hasOwnProperty.call(pageRanges, 'to')) {
@@ -325,9 +334,9 @@ WebContents.prototype.printToPDF = async function (options) {
   printSettings.printerType = 2;
   if (this._printToPDF) {
     if (pendingPromise) {
-      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings));
+      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings, outputPath));
     } else {
-      pendingPromise = this._printToPDF(printSettings);
+      pendingPromise = this._printToPDF(printSettings, outputPath);
     }
     return pendingPromise;
   } else {
@@ -493,6 +502,7 @@ WebContents.prototype._init = function () {
   this.goToOffset = navigationController.goToOffset.bind(navigationController);
   this.getActiveIndex = navigationController.getActiveIndex.bind(navigationController);
   this.length = navigationController.length.bind(navigationController);
+  this._getNavigationState = navigationController.getState.bind(navigationController);
   // Read off the ID at construction time, so that it's accessible even after
   // the underlying C++ WebContents is destroyed.
   const id = this.id;
@@ -1,5 +1,6 @@
 import type { WebContents, LoadURLOptions } from 'electron/main';
 import { EventEmitter } from 'events';
+import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
 
 // JavaScript implementation of Chromium's NavigationController.
 // Instead of relying on Chromium for history control, we completely do history
@@ -11,6 +12,9 @@ export class NavigationController extends EventEmitter {
   inPageIndex: number = -1;
   pendingIndex: number = -1;
   history: string[] = [];
+  // Grows with every change of the history state, so that renderers can tell
+  // stale updates apart.
+  stateSequence: number = 0;
 
   constructor (private webContents: WebContents) {
     super();
@@ -43,9 +47,18 @@ export class NavigationController extends EventEmitter {
         this.currentIndex++;
         this.history.push(url);
       }
+      this.sendStateToRenderer();
     });
   }
 
+  // Pushes the history state to the renderer, so that reading history.length
+  // does not need a synchronous round trip.
+  private sendStateToRenderer () {
+    this.stateSequence++;
+    if (this.webContents.isDestroyed() || !this.webContents.mainFrame) return;
+    this.webContents._sendInternal(IPC_MESSAGES.NAVIGATION_CONTROLLER_STATE, this.getState());
+  }
+
   loadURL (url: string, options?: LoadURLOptions): Promise<void> {
     if (options == null) {
       options = {};
@@ -167,6 +180,7 @@ export class NavigationController extends EventEmitter {
     this.currentIndex = -1;
     this.pendingIndex = -1;
     this.inPageIndex = -1;
+    this.sendStateToRenderer();
   }
 
   goBack () {
@@ -225,4 +239,13 @@ export class NavigationController extends EventEmitter {
   length () {
     return this.history.length;
   }
+
+  getState (): ElectronInternal.NavigationState {
+    return {
+      length: this.length(),
+      index: this.currentIndex,
+      url: this.history[this.currentIndex],
+      sequence: this.stateSequence
+    };
+  }
 }
@@ -53,12 +53,22 @@ const allowedClipboardMethods = (() => {
   }
 })();
 
-ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, function (event, method: string, ...args: any[]) {
+const invokeClipboardMethod = function (method: string, args: any[]) {
   if (!allowedClipboardMethods.has(method)) {
     throw new Error(`Invalid method: ${method}`);
   }
 
   return typeUtils.serialize((clipboard as any)[method](...typeUtils.deserialize(args)));
+};
+
+ipcMainInternal.handle(IPC_MESSAGES.BROWSER_CLIPBOARD, function (event, method: string, ...args: any[]) {
+  return invokeClipboardMethod(method, args);
+});
+
+// Kept for the synchronous clipboard methods, which have no way to wait for
+// an asynchronous reply.
+ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, function (event, method: string, ...args: any[]) {
+  return invokeClipboardMethod(method, args);
 });
 
 if (BUILDFLAG(ENABLE_DESKTOP_CAPTURER)) {
@@ -77,12 +87,29 @@ if (BUILDFLAG(ENABLE_DESKTOP_CAPTURER)) {
   });
 }
 
+// Preload sources are read again for every sandboxed navigation, keep them
+// around until the file changes.
+const preloadSourceCache = new Map<string, { mtimeMs: number, size: number, source: string }>();
+
+const readPreloadSource = async function (preloadPath: string) {
+  const { mtimeMs, size } = await fs.promises.stat(preloadPath);
+  const cached = preloadSourceCache.get(preloadPath);
+  if (cached && cached.mtimeMs === mtimeMs && cached.size === size) {
+    return cached.source;
+  }
+
+  const source = await fs.promises.readFile(preloadPath, 'utf8');
+  preloadSourceCache.set(preloadPath, { mtimeMs, size, source });
+  return source;
+};
+
 const getPreloadScript = async function (preloadPath: string) {
   let preloadSrc = null;
   let preloadError = null;
   try {
-    preloadSrc = await fs.promises.readFile(preloadPath, 'utf8');
+    preloadSrc = await readPreloadSource(preloadPath);
   } catch (error) {
+    preloadSourceCache.delete(preloadPath);
     preloadError = error;
   }
   return { preloadPath, preloadSrc, preloadError };
@@ -116,8 +143,8 @@ ipcMainInternal.on(IPC_MESSAGES.NAVIGATION_CONTROLLER_GO_TO_OFFSET, function (ev
   event.sender.goToOffset(offset);
 });
 
-ipcMainInternal.on(IPC_MESSAGES.NAVIGATION_CONTROLLER_LENGTH, function (event) {
-  event.returnValue = event.sender.length();
+ipcMainInternal.on(IPC_MESSAGES.NAVIGATION_CONTROLLER_GET_STATE, function (event) {
+  event.returnValue = event.sender._getNavigationState();
 });
 
 ipcMainInternal.on(IPC_MESSAGES.BROWSER_PRELOAD_ERROR, function (event, preloadPath: string, error: Error) {
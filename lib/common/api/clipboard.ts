@@ -2,7 +2,14 @@ import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
 
 const clipboard = process._linkedBinding('electron_common_clipboard');
 
+const methods = Object.keys(clipboard) as (keyof Electron.Clipboard)[];
+const promises: Record<string, (...args: any[]) => Promise<any>> = {};
+for (const method of methods) {
+  promises[method] = async (...args: any[]) => (clipboard[method] as Function)(...args);
+}
+
 if (process.type === 'renderer') {
+  const { ipcRendererInternal } = require('@electron/internal/renderer/ipc-renderer-internal');
   const ipcRendererUtils = require('@electron/internal/renderer/ipc-renderer-internal-utils');
   const typeUtils = require('@electron/internal/common/type-utils');
 
@@ -14,16 +21,33 @@ if (process.type === 'renderer') {
     };
   };
 
+  // Does not block the renderer while the main process serves the call.
+  const makeRemotePromiseMethod = function (method: keyof Electron.Clipboard) {
+    return async (...args: any[]) => {
+      args = typeUtils.serialize(args);
+      const result = await ipcRendererInternal.invoke(IPC_MESSAGES.BROWSER_CLIPBOARD, method, ...args);
+      return typeUtils.deserialize(result);
+    };
+  };
+
+  const remoteMethods: (keyof Electron.Clipboard)[] = [];
   if (process.platform === 'linux') {
     // On Linux we could not access clipboard in renderer process.
-    for (const method of Object.keys(clipboard) as (keyof Electron.Clipboard)[]) {
-      clipboard[method] = makeRemoteMethod(method);
-    }
+    remoteMethods.push(...methods);
   } else if (process.platform === 'darwin') {
     // Read/write to find pasteboard over IPC since only main process is notified of changes
-    clipboard.readFindText = makeRemoteMethod('readFindText');
-    clipboard.writeFindText = makeRemoteMethod('writeFindText');
+    remoteMethods.push('readFindText', 'writeFindText');
+  }
+
+  for (const method of remoteMethods) {
+    clipboard[method] = makeRemoteMethod(method);
+    promises[method] = makeRemotePromiseMethod(method);
   }
 }
 
+Object.defineProperty(clipboard, 'promises', {
+  enumerable: false,
+  value: promises
+});
+
 export default clipboard;
@@ -1,4 +1,5 @@
 export const enum IPC_MESSAGES {
+  BROWSER_CLIPBOARD = 'BROWSER_CLIPBOARD',
   BROWSER_CLIPBOARD_SYNC = 'BROWSER_CLIPBOARD_SYNC',
   BROWSER_GET_LAST_WEB_PREFERENCES = 'BROWSER_GET_LAST_WEB_PREFERENCES',
   BROWSER_PRELOAD_ERROR = 'BROWSER_PRELOAD_ERROR',
@@ -33,7 +34,8 @@ export const enum IPC_MESSAGES {
   NAVIGATION_CONTROLLER_GO_BACK = 'NAVIGATION_CONTROLLER_GO_BACK',
   NAVIGATION_CONTROLLER_GO_FORWARD = 'NAVIGATION_CONTROLLER_GO_FORWARD',
   NAVIGATION_CONTROLLER_GO_TO_OFFSET = 'NAVIGATION_CONTROLLER_GO_TO_OFFSET',
-  NAVIGATION_CONTROLLER_LENGTH = 'NAVIGATION_CONTROLLER_LENGTH',
+  NAVIGATION_CONTROLLER_GET_STATE = 'NAVIGATION_CONTROLLER_GET_STATE',
+  NAVIGATION_CONTROLLER_STATE = 'NAVIGATION_CONTROLLER_STATE',
 
   INSPECTOR_CONFIRM = 'INSPECTOR_CONFIRM',
   INSPECTOR_CONTEXT_MENU = 'INSPECTOR_CONTEXT_MENU',
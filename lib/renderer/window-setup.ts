@@ -318,7 +318,63 @@ export const windowSetup = (
     };
     if (contextIsolationEnabled) internalContextBridge.overrideGlobalValueFromIsolatedWorld(['history', 'go'], window.history.go);
 
-    const getHistoryLength = () => ipcRendererInternal.sendSync(IPC_MESSAGES.NAVIGATION_CONTROLLER_LENGTH);
+    // The browser pushes its history state whenever it changes, with a
+    // sequence number that grows with every change. pushState() and
+    // replaceState() commit before the browser's update for them arrives, so
+    // they are applied to the local copy right away, and updates older than
+    // the copy are dropped. Other same-document navigations, such as hash
+    // changes, are not applied locally, so the copy is only used while it is
+    // about the current URL; otherwise the state is read synchronously.
+    let historyState: ElectronInternal.NavigationState | undefined;
+    let minHistorySequence = 0;
+    const setHistoryState = (state: ElectronInternal.NavigationState) => {
+      historyState = state;
+      minHistorySequence = state.sequence;
+    };
+    ipcRendererInternal.on(IPC_MESSAGES.NAVIGATION_CONTROLLER_STATE, function (_event, state: ElectronInternal.NavigationState) {
+      if (state.sequence >= minHistorySequence) setHistoryState(state);
+    });
+
+    const getCurrentHistoryState = () => historyState && historyState.url === window.location.href ? historyState : undefined;
+
+    // Applies a same-document commit to the local copy, the same way the
+    // browser's NavigationController will.
+    const commitHistoryEntry = (current: ElectronInternal.NavigationState | undefined, replace: boolean) => {
+      if (current) {
+        const index = replace ? current.index : current.index + 1;
+        // Pushing drops the forward entries, replacing keeps them.
+        const length = replace ? current.length : index + 1;
+        setHistoryState({ length, index, url: window.location.href, sequence: current.sequence + 1 });
+      } else {
+        // Without a copy to apply the commit to, the next read asks the
+        // browser, and every update until then may be stale.
+        historyState = undefined;
+        minHistorySequence = Infinity;
+      }
+    };
+
+    const { pushState, replaceState } = window.history;
+    window.history.pushState = function (...args: Parameters<History['pushState']>) {
+      const current = getCurrentHistoryState();
+      pushState.apply(window.history, args);
+      commitHistoryEntry(current, false);
+    };
+    if (contextIsolationEnabled) internalContextBridge.overrideGlobalValueFromIsolatedWorld(['history', 'pushState'], window.history.pushState);
+
+    window.history.replaceState = function (...args: Parameters<History['replaceState']>) {
+      const current = getCurrentHistoryState();
+      replaceState.apply(window.history, args);
+      commitHistoryEntry(current, true);
+    };
+    if (contextIsolationEnabled) internalContextBridge.overrideGlobalValueFromIsolatedWorld(['history', 'replaceState'], window.history.replaceState);
+
+    const getHistoryLength = () => {
+      const current = getCurrentHistoryState();
+      if (current) return current.length;
+      const state: ElectronInternal.NavigationState = ipcRendererInternal.sendSync(IPC_MESSAGES.NAVIGATION_CONTROLLER_GET_STATE);
+      setHistoryState(state);
+      return state.length;
+    };
     Object.defineProperty(window.history, 'length', {
       get: getHistoryLength,
       set () {}
@@ -276,6 +276,10 @@ int NodeMain(int argc, char* argv[]) {
 
     node::ResetStdio();
 
+    // The runner's libuv handles have to be closed on this thread, and
+    // before node frees the environment that spins the loop a last time.
+    uv_task_runner->Shutdown();
+
     node::Stop(env);
     node::FreeEnvironment(env);
     node::FreeIsolateData(isolate_data);
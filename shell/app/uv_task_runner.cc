@@ -2,60 +2,208 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <functional>
 #include <utility>
 
 #include "shell/app/uv_task_runner.h"
 
-#include "base/stl_util.h"
-
 namespace electron {
 
-UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {}
+UvTaskRunner::PendingTask::PendingTask(base::OnceClosure task,
+                                       base::TimeTicks run_time,
+                                       uint64_t sequence_num,
+                                       bool nestable)
+    : task(std::move(task)),
+      run_time(run_time),
+      sequence_num(sequence_num),
+      nestable(nestable) {}
+
+UvTaskRunner::PendingTask::PendingTask(PendingTask&& other) = default;
+
+UvTaskRunner::PendingTask::~PendingTask() = default;
+
+UvTaskRunner::PendingTask& UvTaskRunner::PendingTask::operator=(
+    PendingTask&& other) = default;
+
+bool UvTaskRunner::PendingTask::operator>(const PendingTask& other) const {
+  if (run_time != other.run_time)
+    return run_time > other.run_time;
+  return sequence_num > other.sequence_num;
+}
+
+UvTaskRunner::UvTaskRunner(uv_loop_t* loop)
+    : loop_(loop), thread_ref_(base::PlatformThread::CurrentRef()) {
+  uv_timer_init(loop_, timer_.get());
+  timer_.get()->data = this;
+
+  // Cross-thread wakeups must not keep the loop alive on their own, pending
+  // work does so through |timer_|.
+  uv_async_init(loop_, wakeup_.get(), UvTaskRunner::OnWakeup);
+  wakeup_.get()->data = this;
+  uv_unref(wakeup_.handle());
+}
 
 UvTaskRunner::~UvTaskRunner() {
-  for (auto& iter : tasks_) {
-    uv_unref(reinterpret_cast<uv_handle_t*>(iter.first));
-    delete iter.first;
+  DCHECK(!timer_.get() && !wakeup_.get()) << "Shutdown() was not called";
+}
+
+void UvTaskRunner::Shutdown() {
+  DCHECK(RunsTasksInCurrentSequence());
+  base::circular_deque<PendingTask> immediate_tasks;
+  std::vector<PendingTask> delayed_tasks;
+  {
+    base::AutoLock auto_lock(lock_);
+    shutdown_ = true;
+    immediate_tasks.swap(immediate_tasks_);
+    delayed_tasks.swap(delayed_tasks_);
+    // Closed under the lock so that no other thread is still signalling it.
+    wakeup_.reset();
   }
+  timer_.reset();
+  deferred_non_nestable_tasks_.clear();
+  // The dropped tasks are destroyed here, outside of the lock, as their
+  // destructors may post more tasks.
 }
 
 bool UvTaskRunner::PostDelayedTask(const base::Location& from_here,
                                    base::OnceClosure task,
                                    base::TimeDelta delay) {
-  auto* timer = new uv_timer_t;
-  timer->data = this;
-  uv_timer_init(loop_, timer);
-  uv_timer_start(timer, UvTaskRunner::OnTimeout, delay.InMilliseconds(), 0);
-  tasks_[timer] = std::move(task);
-  return true;
+  return PostTaskImpl(std::move(task), delay, true);
 }
 
 bool UvTaskRunner::RunsTasksInCurrentSequence() const {
-  return true;
+  return base::PlatformThread::CurrentRef() == thread_ref_;
 }
 
 bool UvTaskRunner::PostNonNestableDelayedTask(const base::Location& from_here,
                                               base::OnceClosure task,
                                               base::TimeDelta delay) {
-  return PostDelayedTask(from_here, std::move(task), delay);
+  return PostTaskImpl(std::move(task), delay, false);
+}
+
+bool UvTaskRunner::PostTaskImpl(base::OnceClosure task,
+                                base::TimeDelta delay,
+                                bool nestable) {
+  const bool on_loop_thread = RunsTasksInCurrentSequence();
+  {
+    base::AutoLock auto_lock(lock_);
+    if (shutdown_)
+      return false;
+    bool needs_schedule;
+    uint64_t sequence_num = next_sequence_num_++;
+    if (delay <= base::TimeDelta()) {
+      // The timer is already armed for immediate work unless this is the
+      // first immediate task.
+      needs_schedule = immediate_tasks_.empty();
+      immediate_tasks_.emplace_back(std::move(task), base::TimeTicks(),
+                                    sequence_num, nestable);
+    } else {
+      delayed_tasks_.emplace_back(std::move(task),
+                                  base::TimeTicks::Now() + delay,
+                                  sequence_num, nestable);
+      std::push_heap(delayed_tasks_.begin(), delayed_tasks_.end(),
+                     std::greater<PendingTask>());
+      // Only a new earliest task moves the timer.
+      needs_schedule = immediate_tasks_.empty() &&
+                       delayed_tasks_.front().sequence_num == sequence_num;
+    }
+    if (!needs_schedule)
+      return true;
+    // Signalled under the lock so that Shutdown() cannot close |wakeup_| in
+    // the meantime.
+    if (!on_loop_thread) {
+      uv_async_send(wakeup_.get());
+      return true;
+    }
+  }
+
+  ScheduleWork();
+  return true;
+}
+
+void UvTaskRunner::PromoteDelayedTasksLocked(base::TimeTicks now) {
+  while (!delayed_tasks_.empty() && delayed_tasks_.front().run_time <= now) {
+    std::pop_heap(delayed_tasks_.begin(), delayed_tasks_.end(),
+                  std::greater<PendingTask>());
+    immediate_tasks_.push_back(std::move(delayed_tasks_.back()));
+    delayed_tasks_.pop_back();
+  }
+}
+
+void UvTaskRunner::RunPendingTasks() {
+  size_t count;
+  {
+    base::AutoLock auto_lock(lock_);
+    PromoteDelayedTasksLocked(base::TimeTicks::Now());
+    count = immediate_tasks_.size();
+  }
+
+  for (; count > 0; --count) {
+    base::Optional<PendingTask> pending_task;
+    {
+      base::AutoLock auto_lock(lock_);
+      if (immediate_tasks_.empty())
+        break;
+      pending_task.emplace(std::move(immediate_tasks_.front()));
+      immediate_tasks_.pop_front();
+    }
+
+    // Tasks that must not run in a nested loop wait until the outermost task
+    // has returned.
+    if (nesting_depth_ > 0 && !pending_task->nestable) {
+      deferred_non_nestable_tasks_.push_back(std::move(*pending_task));
+      continue;
+    }
+
+    ++nesting_depth_;
+    std::move(pending_task->task).Run();
+    --nesting_depth_;
+  }
+
+  if (nesting_depth_ == 0 && !deferred_non_nestable_tasks_.empty()) {
+    base::AutoLock auto_lock(lock_);
+    while (!deferred_non_nestable_tasks_.empty()) {
+      immediate_tasks_.push_front(
+          std::move(deferred_non_nestable_tasks_.back()));
+      deferred_non_nestable_tasks_.pop_back();
+    }
+  }
+
+  ScheduleWork();
+}
+
+void UvTaskRunner::ScheduleWork() {
+  DCHECK(RunsTasksInCurrentSequence());
+  base::Optional<base::TimeDelta> delay;
+  {
+    base::AutoLock auto_lock(lock_);
+    if (shutdown_)
+      return;
+    if (!immediate_tasks_.empty()) {
+      delay = base::TimeDelta();
+    } else if (!delayed_tasks_.empty()) {
+      delay = std::max(delayed_tasks_.front().run_time - base::TimeTicks::Now(),
+                       base::TimeDelta());
+    }
+  }
+
+  if (delay) {
+    uv_timer_start(timer_.get(), UvTaskRunner::OnTimeout,
+                   delay->InMillisecondsRoundedUp(), 0);
+  } else {
+    uv_timer_stop(timer_.get());
+  }
 }
 
 // static
 void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
-  auto& tasks = static_cast<UvTaskRunner*>(timer->data)->tasks_;
-  const auto iter = tasks.find(timer);
-  if (iter == std::end(tasks))
-    return;
-
-  std::move(iter->second).Run();
-  tasks.erase(iter);
-  uv_timer_stop(timer);
-  uv_close(reinterpret_cast<uv_handle_t*>(timer), UvTaskRunner::OnClose);
+  static_cast<UvTaskRunner*>(timer->data)->RunPendingTasks();
 }
 
 // static
-void UvTaskRunner::OnClose(uv_handle_t* handle) {
-  delete reinterpret_cast<uv_timer_t*>(handle);
+void UvTaskRunner::OnWakeup(uv_async_t* async) {
+  static_cast<UvTaskRunner*>(async->data)->ScheduleWork();
 }
 
 }  // namespace electron
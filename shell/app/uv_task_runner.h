@@ -5,20 +5,36 @@
 #ifndef SHELL_APP_UV_TASK_RUNNER_H_
 #define SHELL_APP_UV_TASK_RUNNER_H_
 
-#include <map>
+#include <vector>
 
 #include "base/callback.h"
+#include "base/containers/circular_deque.h"
 #include "base/location.h"
+#include "base/optional.h"
 #include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+#include "shell/common/node_bindings.h"
 #include "uv.h"  // NOLINT(build/include_directory)
 
 namespace electron {
 
 // TaskRunner implementation that posts tasks into libuv's default loop.
+//
+// All tasks share a single uv_timer_t, which is armed for the earliest pending
+// task and keeps the loop alive while there is work. Tasks posted from other
+// threads wake the loop through an unreferenced uv_async_t.
 class UvTaskRunner : public base::SingleThreadTaskRunner {
  public:
   explicit UvTaskRunner(uv_loop_t* loop);
 
+  // Closes the libuv handles and drops the pending tasks. Must be called on
+  // the loop thread before the loop is torn down, since the last reference
+  // to the runner may be released on another thread. Later posts fail.
+  void Shutdown();
+
   // base::SingleThreadTaskRunner:
   bool PostDelayedTask(const base::Location& from_here,
                        base::OnceClosure task,
@@ -29,13 +45,63 @@ class UvTaskRunner : public base::SingleThreadTaskRunner {
                                   base::TimeDelta delay) override;
 
  private:
+  friend class UvTaskRunnerTest;
+
+  struct PendingTask {
+    PendingTask(base::OnceClosure task,
+                base::TimeTicks run_time,
+                uint64_t sequence_num,
+                bool nestable);
+    PendingTask(PendingTask&& other);
+    ~PendingTask();
+    PendingTask& operator=(PendingTask&& other);
+
+    // Orders the delayed task heap so that the earliest task is on top, ties
+    // being broken by posting order.
+    bool operator>(const PendingTask& other) const;
+
+    base::OnceClosure task;
+    base::TimeTicks run_time;
+    uint64_t sequence_num;
+    bool nestable;
+  };
+
   ~UvTaskRunner() override;
+
+  bool PostTaskImpl(base::OnceClosure task,
+                    base::TimeDelta delay,
+                    bool nestable);
+
+  // Runs the tasks that are due, then re-arms |timer_|. Only the tasks that
+  // were due on entry are run so that libuv gets to poll in between.
+  void RunPendingTasks();
+
+  // Arms |timer_| for the next pending task, or stops it when idle.
+  void ScheduleWork();
+
+  // Moves the delayed tasks that are due into |immediate_tasks_|.
+  void PromoteDelayedTasksLocked(base::TimeTicks now)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   static void OnTimeout(uv_timer_t* timer);
-  static void OnClose(uv_handle_t* handle);
+  static void OnWakeup(uv_async_t* async);
 
   uv_loop_t* loop_;
+  const base::PlatformThreadRef thread_ref_;
+
+  UvHandle<uv_timer_t> timer_;
+  UvHandle<uv_async_t> wakeup_;
+
+  base::Lock lock_;
+  bool shutdown_ GUARDED_BY(lock_) = false;
+  uint64_t next_sequence_num_ GUARDED_BY(lock_) = 0;
+  base::circular_deque<PendingTask> immediate_tasks_ GUARDED_BY(lock_);
+  // Min-heap ordered by PendingTask::operator>.
+  std::vector<PendingTask> delayed_tasks_ GUARDED_BY(lock_);
 
-  std::map<uv_timer_t*, base::OnceClosure> tasks_;
+  // Loop thread only.
+  int nesting_depth_ = 0;
+  base::circular_deque<PendingTask> deferred_non_nestable_tasks_;
 
   DISALLOW_COPY_AND_ASSIGN(UvTaskRunner);
 };
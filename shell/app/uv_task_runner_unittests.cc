@@ -0,0 +1,133 @@
+// Copyright (c) 2021 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/app/uv_task_runner.h"
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/test/bind.h"
+#include "base/threading/thread.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+using testing::ElementsAre;
+
+namespace electron {
+
+class UvTaskRunnerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(0, uv_loop_init(&loop_));
+    runner_ = base::MakeRefCounted<UvTaskRunner>(&loop_);
+  }
+
+  void TearDown() override {
+    runner_->Shutdown();
+    runner_ = nullptr;
+    // Runs the close callbacks of the runner's handles.
+    uv_run(&loop_, UV_RUN_DEFAULT);
+    EXPECT_EQ(0, uv_loop_close(&loop_));
+  }
+
+  // Returns when no task is pending anymore.
+  void RunLoop() { uv_run(&loop_, UV_RUN_DEFAULT); }
+
+  // Runs the due tasks from within a task, as a nested message loop would.
+  void RunNestedTasks() { runner_->RunPendingTasks(); }
+
+  base::OnceClosure Record(const std::string& name) {
+    return base::BindOnce(
+        [](std::vector<std::string>* order, const std::string& name) {
+          order->push_back(name);
+        },
+        &order_, name);
+  }
+
+  uv_loop_t loop_;
+  scoped_refptr<UvTaskRunner> runner_;
+  std::vector<std::string> order_;
+};
+
+TEST_F(UvTaskRunnerTest, ImmediateTasksRunInPostingOrder) {
+  runner_->PostTask(FROM_HERE, Record("a"));
+  runner_->PostTask(FROM_HERE, Record("b"));
+  runner_->PostTask(FROM_HERE, Record("c"));
+  RunLoop();
+  EXPECT_THAT(order_, ElementsAre("a", "b", "c"));
+}
+
+TEST_F(UvTaskRunnerTest, DelayedTasksRunByRunTimeThenPostingOrder) {
+  runner_->PostDelayedTask(FROM_HERE, Record("late"),
+                           base::TimeDelta::FromMilliseconds(20));
+  runner_->PostDelayedTask(FROM_HERE, Record("early1"),
+                           base::TimeDelta::FromMilliseconds(10));
+  runner_->PostTask(FROM_HERE, Record("immediate"));
+  runner_->PostDelayedTask(FROM_HERE, Record("early2"),
+                           base::TimeDelta::FromMilliseconds(10));
+  RunLoop();
+  EXPECT_THAT(order_, ElementsAre("immediate", "early1", "early2", "late"));
+}
+
+TEST_F(UvTaskRunnerTest, TasksPostedByTasksRunAfterThem) {
+  runner_->PostTask(FROM_HERE, base::BindLambdaForTesting([&] {
+                      order_.push_back("outer");
+                      runner_->PostTask(FROM_HERE, Record("posted"));
+                    }));
+  runner_->PostTask(FROM_HERE, Record("next"));
+  RunLoop();
+  EXPECT_THAT(order_, ElementsAre("outer", "next", "posted"));
+}
+
+TEST_F(UvTaskRunnerTest, CrossThreadPostsRunInPostingOrder) {
+  // Keeps the loop running until the other thread's last task has run.
+  uv_async_t keep_alive;
+  uv_async_init(&loop_, &keep_alive, nullptr);
+
+  base::Thread thread("UvTaskRunnerTest");
+  ASSERT_TRUE(thread.Start());
+  thread.task_runner()->PostTask(
+      FROM_HERE, base::BindLambdaForTesting([&] {
+        EXPECT_FALSE(runner_->RunsTasksInCurrentSequence());
+        runner_->PostTask(FROM_HERE, Record("a"));
+        runner_->PostDelayedTask(FROM_HERE, Record("delayed"),
+                                 base::TimeDelta::FromMilliseconds(10));
+        runner_->PostTask(FROM_HERE, Record("b"));
+        runner_->PostDelayedTask(
+            FROM_HERE, base::BindLambdaForTesting([&] {
+              uv_close(reinterpret_cast<uv_handle_t*>(&keep_alive), nullptr);
+            }),
+            base::TimeDelta::FromMilliseconds(20));
+      }));
+  RunLoop();
+  thread.Stop();
+
+  EXPECT_THAT(order_, ElementsAre("a", "b", "delayed"));
+}
+
+TEST_F(UvTaskRunnerTest, NonNestableTasksWaitForTheOutermostTask) {
+  runner_->PostTask(FROM_HERE, base::BindLambdaForTesting([&] {
+                      runner_->PostNonNestableTask(FROM_HERE,
+                                                   Record("non-nestable"));
+                      runner_->PostTask(FROM_HERE, Record("nestable"));
+                      RunNestedTasks();
+                      order_.push_back("outer done");
+                    }));
+  runner_->PostTask(FROM_HERE, Record("next"));
+  RunLoop();
+  EXPECT_THAT(order_, ElementsAre("next", "nestable", "outer done",
+                                  "non-nestable"));
+}
+
+TEST_F(UvTaskRunnerTest, PostsFailAfterShutdown) {
+  runner_->PostTask(FROM_HERE, Record("dropped"));
+  runner_->Shutdown();
+  EXPECT_FALSE(runner_->PostTask(FROM_HERE, Record("rejected")));
+  RunLoop();
+  EXPECT_TRUE(order_.empty());
+}
+
+}  // namespace electron
@@ -17,6 +17,8 @@
 #include "base/optional.h"
 #include "base/path_service.h"
 #include "base/system/sys_info.h"
+#include "base/task_runner_util.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/common/chrome_paths.h"
@@ -73,6 +75,40 @@ using electron::Browser;
 
 namespace gin {
 
+template <>
+struct Converter<electron::ProcessMetricsSampler::Sample> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      const electron::ProcessMetricsSampler::Sample& sample) {
+    gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+    dict.SetHidden("simple", true);
+    dict.Set("time", sample.time.ToJsTime());
+    dict.Set("percentCPUUsage", sample.percent_cpu_usage);
+    dict.Set("idleWakeupsPerSecond", sample.idle_wakeups_per_second);
+    dict.Set("workingSetSize", static_cast<double>(sample.working_set_size));
+    return dict.GetHandle();
+  }
+};
+
+template <>
+struct Converter<electron::ProcessMetricsSampler::History> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      const electron::ProcessMetricsSampler::History& history) {
+    gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+    dict.SetHidden("simple", true);
+    dict.Set("pid", history.pid);
+    dict.Set("type", content::GetProcessTypeNameInEnglish(history.type));
+    dict.Set("creationTime", history.creation_time.ToJsTime());
+    if (!history.service_name.empty())
+      dict.Set("serviceName", history.service_name);
+    if (!history.name.empty())
+      dict.Set("name", history.name);
+    dict.Set("samples", history.samples);
+    return dict.GetHandle();
+  }
+};
+
 #if defined(OS_WIN)
 template <>
 struct Converter<electron::ProcessIntegrityLevel> {
@@ -594,6 +630,27 @@ void OnIconDataAvailable(gin_helper::Promise<gfx::Image> promise,
   }
 }
 
+std::unique_ptr<base::ProcessMetrics> CreateProcessMetrics(
+    base::ProcessHandle handle) {
+#if defined(OS_MAC)
+  return base::ProcessMetrics::CreateProcessMetrics(
+      handle, content::BrowserChildProcessHost::GetPortProvider());
+#else
+  return base::ProcessMetrics::CreateProcessMetrics(handle);
+#endif
+}
+
+// The sampler needs its own base::ProcessMetrics, as CPU usage is measured
+// relative to the previous call on the same instance.
+std::unique_ptr<ProcessMetric> CopyProcessMetric(const ProcessMetric& metric) {
+  auto metrics = metric.type == content::PROCESS_TYPE_BROWSER
+                     ? base::ProcessMetrics::CreateCurrentProcessMetrics()
+                     : CreateProcessMetrics(metric.process.Handle());
+  return std::make_unique<ProcessMetric>(metric.type, metric.process.Handle(),
+                                         std::move(metrics),
+                                         metric.service_name, metric.name);
+}
+
 }  // namespace
 
 App::App() {
@@ -905,18 +962,27 @@ void App::ChildProcessLaunched(int process_type,
                                base::ProcessHandle handle,
                                const std::string& service_name,
                                const std::string& name) {
-#if defined(OS_MAC)
-  auto metrics = base::ProcessMetrics::CreateProcessMetrics(
-      handle, content::BrowserChildProcessHost::GetPortProvider());
-#else
-  auto metrics = base::ProcessMetrics::CreateProcessMetrics(handle);
-#endif
-  app_metrics_[pid] = std::make_unique<electron::ProcessMetric>(
-      process_type, handle, std::move(metrics), service_name, name);
+  auto& metric = app_metrics_[pid];
+  metric = std::make_unique<electron::ProcessMetric>(
+      process_type, handle, CreateProcessMetrics(handle), service_name, name);
+
+  if (sampler_) {
+    sampler_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&ProcessMetricsSampler::AddProcess,
+                       base::Unretained(sampler_.get()), pid,
+                       CopyProcessMetric(*metric)));
+  }
 }
 
 void App::ChildProcessDisconnected(int pid) {
   app_metrics_.erase(pid);
+
+  if (sampler_) {
+    sampler_task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&ProcessMetricsSampler::RemoveProcess,
+                                  base::Unretained(sampler_.get()), pid));
+  }
 }
 
 base::FilePath App::GetAppPath() const {
@@ -1393,6 +1459,116 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+void App::StartMetricsSampling(gin::Arguments* args) {
+  ProcessMetricsSampler::Options options;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    double interval;
+    if (dict.Get("interval", &interval)) {
+      if (!(interval >= 100)) {
+        args->ThrowTypeError("interval must be at least 100 milliseconds");
+        return;
+      }
+      options.interval = base::TimeDelta::FromMillisecondsD(interval);
+    }
+    double history_size;
+    if (dict.Get("historySize", &history_size)) {
+      if (!(history_size >= 1) ||
+          history_size != static_cast<int>(history_size)) {
+        args->ThrowTypeError("historySize must be a positive integer");
+        return;
+      }
+      options.history_size = static_cast<size_t>(history_size);
+    }
+    dict.Get("cpuThreshold", &options.cpu_threshold);
+    double memory_threshold;
+    if (dict.Get("memoryThreshold", &memory_threshold) && memory_threshold > 0)
+      options.memory_threshold = static_cast<size_t>(memory_threshold);
+  }
+
+  StopMetricsSampling();
+  if (!sampler_task_runner_)
+    sampler_task_runner_ = ProcessMetricsSampler::CreateTaskRunner();
+
+  auto callback = base::BindRepeating(
+      [](scoped_refptr<base::SingleThreadTaskRunner> task_runner,
+         base::WeakPtr<App> app, ProcessMetricsSampler::ThresholdEvent event) {
+        task_runner->PostTask(
+            FROM_HERE, base::BindOnce(&App::OnMetricsThresholdExceeded, app,
+                                      std::move(event)));
+      },
+      base::ThreadTaskRunnerHandle::Get(), weak_factory_.GetWeakPtr());
+
+  // Every task below is posted before the sampler's deletion, so it is safe
+  // to pass it unretained.
+  sampler_ = std::unique_ptr<ProcessMetricsSampler, base::OnTaskRunnerDeleter>(
+      new ProcessMetricsSampler(options, std::move(callback)),
+      base::OnTaskRunnerDeleter(sampler_task_runner_));
+  for (const auto& it : app_metrics_) {
+    sampler_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(&ProcessMetricsSampler::AddProcess,
+                       base::Unretained(sampler_.get()), it.first,
+                       CopyProcessMetric(*it.second)));
+  }
+  sampler_task_runner_->PostTask(
+      FROM_HERE, base::BindOnce(&ProcessMetricsSampler::Start,
+                                base::Unretained(sampler_.get())));
+}
+
+void App::StopMetricsSampling() {
+  sampler_.reset();
+}
+
+v8::Local<v8::Promise> App::GetMetricsHistory(gin::Arguments* args) {
+  gin_helper::Promise<std::vector<ProcessMetricsSampler::History>> promise(
+      args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!sampler_) {
+    promise.RejectWithErrorMessage("Metrics sampling has not been started");
+    return handle;
+  }
+
+  double count = 0;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict) && dict.Get("count", &count) &&
+      (!(count >= 1) || count != static_cast<int>(count))) {
+    promise.RejectWithErrorMessage("count must be a positive integer");
+    return handle;
+  }
+
+  base::PostTaskAndReplyWithResult(
+      sampler_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&ProcessMetricsSampler::GetHistory,
+                     base::Unretained(sampler_.get()),
+                     static_cast<size_t>(count)),
+      base::BindOnce(
+          [](gin_helper::Promise<std::vector<ProcessMetricsSampler::History>>
+                 promise,
+             std::vector<ProcessMetricsSampler::History> history) {
+            promise.Resolve(history);
+          },
+          std::move(promise)));
+  return handle;
+}
+
+void App::OnMetricsThresholdExceeded(
+    ProcessMetricsSampler::ThresholdEvent event) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  auto details = gin_helper::Dictionary::CreateEmpty(isolate);
+  details.Set("pid", event.pid);
+  details.Set("type", content::GetProcessTypeNameInEnglish(event.type));
+  if (!event.name.empty()) {
+    details.Set("name", event.name);
+  }
+  details.Set("metric", event.metric);
+  details.Set("value", event.value);
+  details.Set("threshold", event.threshold);
+  Emit("metrics-threshold-exceeded", details);
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   auto status = content::GetFeatureStatus();
   base::DictionaryValue temp;
@@ -1658,6 +1834,9 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  &App::DisableDomainBlockingFor3DAPIs)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("startMetricsSampling", &App::StartMetricsSampling)
+      .SetMethod("stopMetricsSampling", &App::StopMetricsSampling)
+      .SetMethod("getMetricsHistory", &App::GetMetricsHistory)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if defined(MAS_BUILD)
@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "base/task/cancelable_task_tracker.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/browser/process_singleton.h"
@@ -22,6 +24,7 @@
 #include "net/base/completion_repeating_callback.h"
 #include "net/ssl/client_cert_identity.h"
 #include "shell/browser/api/process_metric.h"
+#include "shell/browser/api/process_metrics_sampler.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/browser_observer.h"
 #include "shell/browser/electron_browser_client.h"
@@ -207,6 +210,10 @@ class App : public ElectronBrowserClient::Delegate,
                                      gin::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  void StartMetricsSampling(gin::Arguments* args);
+  void StopMetricsSampling();
+  v8::Local<v8::Promise> GetMetricsHistory(gin::Arguments* args);
+  void OnMetricsThresholdExceeded(ProcessMetricsSampler::ThresholdEvent event);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
                                     const std::string& info_type);
@@ -254,9 +261,16 @@ class App : public ElectronBrowserClient::Delegate,
       std::map<int, std::unique_ptr<electron::ProcessMetric>>;
   ProcessMetricMap app_metrics_;
 
+  // Opt-in sampler of |app_metrics_|, living on |sampler_task_runner_|.
+  scoped_refptr<base::SequencedTaskRunner> sampler_task_runner_;
+  std::unique_ptr<ProcessMetricsSampler, base::OnTaskRunnerDeleter> sampler_{
+      nullptr, base::OnTaskRunnerDeleter(nullptr)};
+
   bool disable_hw_acceleration_ = false;
   bool disable_domain_blocking_for_3DAPIs_ = false;
 
+  base::WeakPtrFactory<App> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(App);
 };
 
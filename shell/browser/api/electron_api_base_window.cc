@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_base_window.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -153,6 +154,8 @@ void BaseWindow::OnWindowClosed() {
   // there might be some delayed emit events which shouldn't be
   // triggered after this.
   weak_factory_.InvalidateWeakPtrs();
+  resize_event_.pending.Stop();
+  move_event_.pending.Stop();
 
   RemoveFromWeakMap();
   window_->RemoveObserver(this);
@@ -214,10 +217,11 @@ void BaseWindow::OnWindowWillResize(const gfx::Rect& new_bounds,
 }
 
 void BaseWindow::OnWindowResize() {
-  Emit("resize");
+  EmitThrottled(&resize_event_);
 }
 
 void BaseWindow::OnWindowResized() {
+  EmitPending(&resize_event_);
   Emit("resized");
 }
 
@@ -229,10 +233,11 @@ void BaseWindow::OnWindowWillMove(const gfx::Rect& new_bounds,
 }
 
 void BaseWindow::OnWindowMove() {
-  Emit("move");
+  EmitThrottled(&move_event_);
 }
 
 void BaseWindow::OnWindowMoved() {
+  EmitPending(&move_event_);
   Emit("moved");
 }
 
@@ -412,6 +417,13 @@ gfx::Rect BaseWindow::GetNormalBounds() {
   return window_->GetNormalBounds();
 }
 
+void BaseWindow::SetBoundsEventInterval(int interval_ms) {
+  bounds_event_interval_ =
+      base::TimeDelta::FromMilliseconds(std::max(interval_ms, 0));
+  EmitPending(&resize_event_);
+  EmitPending(&move_event_);
+}
+
 void BaseWindow::SetContentBounds(const gfx::Rect& bounds,
                                   gin_helper::Arguments* args) {
   bool animate = false;
@@ -1135,6 +1147,40 @@ void BaseWindow::ResetBrowserViews() {
   browser_views_.clear();
 }
 
+void BaseWindow::EmitThrottled(ThrottledEvent* event) {
+  if (bounds_event_interval_.is_zero()) {
+    Emit(event->name);
+    return;
+  }
+
+  // Listeners read the current bounds when the event arrives, so an event
+  // that is already pending covers this change too.
+  if (event->pending.IsRunning())
+    return;
+
+  base::TimeDelta elapsed = base::TimeTicks::Now() - event->last_emitted;
+  if (elapsed >= bounds_event_interval_) {
+    EmitThrottledNow(event);
+    return;
+  }
+
+  event->pending.Start(FROM_HERE, bounds_event_interval_ - elapsed,
+                       base::BindOnce(&BaseWindow::EmitThrottledNow,
+                                      base::Unretained(this), event));
+}
+
+void BaseWindow::EmitPending(ThrottledEvent* event) {
+  if (!event->pending.IsRunning())
+    return;
+  event->pending.Stop();
+  EmitThrottledNow(event);
+}
+
+void BaseWindow::EmitThrottledNow(ThrottledEvent* event) {
+  event->last_emitted = base::TimeTicks::Now();
+  Emit(event->name);
+}
+
 void BaseWindow::RemoveFromParentChildWindows() {
   if (parent_window_.IsEmpty())
     return;
@@ -1186,6 +1232,7 @@ void BaseWindow::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("getBounds", &BaseWindow::GetBounds)
       .SetMethod("isNormal", &BaseWindow::IsNormal)
       .SetMethod("getNormalBounds", &BaseWindow::GetNormalBounds)
+      .SetMethod("setBoundsEventInterval", &BaseWindow::SetBoundsEventInterval)
       .SetMethod("setSize", &BaseWindow::SetSize)
       .SetMethod("getSize", &BaseWindow::GetSize)
       .SetMethod("setContentBounds", &BaseWindow::SetContentBounds)
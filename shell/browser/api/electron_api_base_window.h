@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/task/post_task.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "gin/handle.h"
@@ -119,6 +121,7 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   gfx::Rect GetContentBounds();
   bool IsNormal();
   gfx::Rect GetNormalBounds();
+  void SetBoundsEventInterval(int interval_ms);
   void SetMinimumSize(int width, int height);
   std::vector<int> GetMinimumSize();
   void SetMaximumSize(int width, int height);
@@ -250,6 +253,21 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   // Remove BrowserView.
   void ResetBrowserView();
 
+  // A "resize" or "move" event that is emitted at most once per
+  // |bounds_event_interval_|.
+  struct ThrottledEvent {
+    const char* name;
+    base::TimeTicks last_emitted;
+    base::OneShotTimer pending;
+  };
+
+  // Emits |event| now if the interval has passed since it was last emitted,
+  // otherwise makes sure it is emitted once the interval is over.
+  void EmitThrottled(ThrottledEvent* event);
+  // Emits |event| right away if it is waiting for the interval to pass.
+  void EmitPending(ThrottledEvent* event);
+  void EmitThrottledNow(ThrottledEvent* event);
+
   // Remove this window from parent window's |child_windows_|.
   void RemoveFromParentChildWindows();
 
@@ -266,6 +284,10 @@ class BaseWindow : public gin_helper::TrackableObject<BaseWindow>,
   MessageCallbackMap messages_callback_map_;
 #endif
 
+  base::TimeDelta bounds_event_interval_;
+  ThrottledEvent resize_event_{"resize"};
+  ThrottledEvent move_event_{"move"};
+
   v8::Global<v8::Value> content_view_;
   std::map<int32_t, v8::Global<v8::Value>> browser_views_;
   v8::Global<v8::Value> menu_;
@@ -2,14 +2,18 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
 
 #include "base/files/file_util.h"
+#include "base/no_destructor.h"
 #include "base/optional.h"
 #include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
+#include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/tracing_controller.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
@@ -56,6 +60,57 @@ struct Converter<base::trace_event::TraceConfig> {
 namespace {
 
 using CompletionCallback = base::OnceCallback<void(const base::FilePath&)>;
+using ChunkCallback = base::RepeatingCallback<void(v8::Local<v8::Value>)>;
+
+// The configuration of the recording in progress, kept so that a snapshot
+// can resume recording with the same settings.
+base::Optional<base::trace_event::TraceConfig>& CurrentTraceConfig() {
+  static base::NoDestructor<base::Optional<base::trace_event::TraceConfig>>
+      trace_config;
+  return *trace_config;
+}
+
+// Hands |data| over to a Buffer without copying it.
+v8::Local<v8::Value> StringToBuffer(v8::Isolate* isolate,
+                                    std::unique_ptr<std::string> data) {
+  if (!data || data->empty())
+    return node::Buffer::New(isolate, 0).ToLocalChecked();
+  std::string* owned_data = data.release();
+  return node::Buffer::New(
+             isolate, &owned_data->front(), owned_data->size(),
+             [](char*, void* hint) { delete static_cast<std::string*>(hint); },
+             owned_data)
+      .ToLocalChecked();
+}
+
+// Forwards trace data to the UI thread chunk by chunk as it is collected,
+// instead of accumulating the whole trace first.
+class ChunkedTraceDataEndpoint : public TracingController::TraceDataEndpoint {
+ public:
+  ChunkedTraceDataEndpoint(
+      base::RepeatingCallback<void(std::unique_ptr<std::string>)> on_chunk,
+      base::OnceClosure on_finished)
+      : on_chunk_(std::move(on_chunk)), on_finished_(std::move(on_finished)) {}
+
+  // TracingController::TraceDataEndpoint
+  void ReceiveTraceChunk(std::unique_ptr<std::string> chunk) override {
+    content::GetUIThreadTaskRunner({})->PostTask(
+        FROM_HERE, base::BindOnce(on_chunk_, std::move(chunk)));
+  }
+
+  void ReceivedTraceFinalContents() override {
+    content::GetUIThreadTaskRunner({})->PostTask(FROM_HERE,
+                                                 std::move(on_finished_));
+  }
+
+ private:
+  ~ChunkedTraceDataEndpoint() override = default;
+
+  base::RepeatingCallback<void(std::unique_ptr<std::string>)> on_chunk_;
+  base::OnceClosure on_finished_;
+
+  DISALLOW_COPY_AND_ASSIGN(ChunkedTraceDataEndpoint);
+};
 
 base::Optional<base::FilePath> CreateTemporaryFileOnIO() {
   base::FilePath temp_file_path;
@@ -93,6 +148,8 @@ v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args) {
   gin_helper::Promise<base::FilePath> promise(args->isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
+  CurrentTraceConfig().reset();
+
   base::FilePath path;
   if (args->GetNext(&path) && !path.empty()) {
     StopTracing(std::move(promise), base::make_optional(path));
@@ -107,6 +164,76 @@ v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args) {
   return handle;
 }
 
+void OnSnapshotChunk(v8::Isolate* isolate,
+                     const ChunkCallback& on_chunk,
+                     std::unique_ptr<std::string> chunk) {
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  on_chunk.Run(StringToBuffer(isolate, std::move(chunk)));
+}
+
+void OnSnapshotFinished(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                        std::unique_ptr<std::string> data) {
+  // Resume recording before handing the data to JS. The gap still spans the
+  // whole collection from every child process.
+  if (CurrentTraceConfig()) {
+    TracingController::GetInstance()->StartTracing(*CurrentTraceConfig(),
+                                                   base::DoNothing());
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  promise.Resolve(StringToBuffer(isolate, std::move(data)));
+}
+
+v8::Local<v8::Promise> TakeSnapshot(gin_helper::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  bool keep_recording = true;
+  ChunkCallback on_chunk;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("keepRecording", &keep_recording);
+    options.Get("onChunk", &on_chunk);
+  }
+  if (!keep_recording) {
+    CurrentTraceConfig().reset();
+  } else if (!CurrentTraceConfig() &&
+             TracingController::GetInstance()->IsTracing()) {
+    // e.g. --trace-startup, whose config is unknown here, so it could not be
+    // restarted after the snapshot.
+    promise.RejectWithErrorMessage(
+        "keepRecording requires the trace to be started with "
+        "contentTracing.startRecording()");
+    return handle;
+  }
+
+  scoped_refptr<TracingController::TraceDataEndpoint> endpoint;
+  if (on_chunk) {
+    endpoint = base::MakeRefCounted<ChunkedTraceDataEndpoint>(
+        base::BindRepeating(&OnSnapshotChunk, isolate, std::move(on_chunk)),
+        base::BindOnce(&OnSnapshotFinished, std::move(promise),
+                       std::unique_ptr<std::string>()));
+  } else {
+    endpoint = TracingController::CreateStringEndpoint(
+        base::BindOnce(&OnSnapshotFinished, std::move(promise)));
+  }
+
+  if (!TracingController::GetInstance()->StopTracing(endpoint)) {
+    CurrentTraceConfig().reset();
+    // The endpoint never runs its callbacks, so the promise it holds is
+    // abandoned along with it.
+    gin_helper::Promise<void> error(isolate);
+    error.RejectWithErrorMessage(
+        "Failed to take a snapshot (was a trace in progress?)");
+    return error.GetHandle();
+  }
+  return handle;
+}
+
 v8::Local<v8::Promise> GetCategories(v8::Isolate* isolate) {
   gin_helper::Promise<const std::set<std::string>&> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
@@ -135,6 +262,7 @@ v8::Local<v8::Promise> StartTracing(
     // this point).
     return gin_helper::Promise<void>::ResolvedPromise(isolate);
   }
+  CurrentTraceConfig() = trace_config;
   return handle;
 }
 
@@ -167,6 +295,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("getCategories", &GetCategories);
   dict.SetMethod("startRecording", &StartTracing);
   dict.SetMethod("stopRecording", &StopRecording);
+  dict.SetMethod("takeSnapshot", &TakeSnapshot);
   dict.SetMethod("getTraceBufferUsage", &GetTraceBufferUsage);
 }
 
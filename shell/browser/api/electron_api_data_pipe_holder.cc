@@ -4,16 +4,15 @@
 
 #include "shell/browser/api/electron_api_data_pipe_holder.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 
-#include "base/memory/weak_ptr.h"
 #include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
-#include "mojo/public/cpp/system/data_pipe.h"
-#include "mojo/public/cpp/system/simple_watcher.h"
+#include "gin/object_template_builder.h"
 #include "net/base/net_errors.h"
-#include "shell/common/gin_helper/promise.h"
 #include "shell/common/key_weak_map.h"
 
 #include "shell/common/node_includes.h"
@@ -33,13 +32,39 @@ KeyWeakMap<std::string>& AllDataPipeHolders() {
   return *weak_map.get();
 }
 
+// Size of the chunks handed out by BlobDataReader.
+constexpr uint32_t kReadChunkSize = 64 * 1024;
+
+// Clamp the range [|*offset|, |*offset| + |*length|) to data of |size| bytes.
+void ClampRange(uint64_t size, uint64_t* offset, uint64_t* length) {
+  *offset = std::min(*offset, size);
+  *length = std::min(*length, size - *offset);
+}
+
+// Discard up to |*bytes_to_skip| bytes from the front of the pipe.
+MojoResult SkipData(const mojo::ScopedDataPipeConsumerHandle& data_pipe,
+                    uint64_t* bytes_to_skip) {
+  uint32_t length = static_cast<uint32_t>(std::min<uint64_t>(
+      *bytes_to_skip, std::numeric_limits<uint32_t>::max()));
+  MojoResult result =
+      data_pipe->ReadData(nullptr, &length, MOJO_READ_DATA_FLAG_DISCARD);
+  if (result == MOJO_RESULT_OK)
+    *bytes_to_skip -= length;
+  return result;
+}
+
 // Utility class to read from data pipe.
 class DataPipeReader {
  public:
   DataPipeReader(gin_helper::Promise<v8::Local<v8::Value>> promise,
-                 mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter)
+                 mojo::PendingRemote<network::mojom::DataPipeGetter>
+                     data_pipe_getter,
+                 uint64_t offset,
+                 uint64_t length)
       : promise_(std::move(promise)),
         data_pipe_getter_(std::move(data_pipe_getter)),
+        offset_(offset),
+        length_(length),
         handle_watcher_(FROM_HERE,
                         mojo::SimpleWatcher::ArmingPolicy::MANUAL,
                         base::SequencedTaskRunnerHandle::Get()) {
@@ -64,9 +89,15 @@ class DataPipeReader {
       OnFailure();
       return;
     }
-    buffer_.resize(size);
+    ClampRange(size, &offset_, &length_);
+    if (length_ == 0) {
+      OnSuccess();
+      return;
+    }
+    buffer_.resize(length_);
     head_ = &buffer_.front();
-    remaining_size_ = size;
+    bytes_to_skip_ = offset_;
+    remaining_size_ = length_;
     handle_watcher_.ArmOrNotify();
   }
 
@@ -78,14 +109,30 @@ class DataPipeReader {
       return;
     }
 
+    // Skip the bytes before the requested range.
+    while (bytes_to_skip_ > 0) {
+      result = SkipData(data_pipe_, &bytes_to_skip_);
+      if (result == MOJO_RESULT_SHOULD_WAIT) {
+        handle_watcher_.ArmOrNotify();
+        return;
+      }
+      if (result != MOJO_RESULT_OK) {
+        OnFailure();
+        return;
+      }
+    }
+
     // Read.
-    uint32_t length = remaining_size_;
+    uint32_t length = static_cast<uint32_t>(std::min<uint64_t>(
+        remaining_size_, std::numeric_limits<uint32_t>::max()));
     result = data_pipe_->ReadData(head_, &length, MOJO_READ_DATA_FLAG_NONE);
     if (result == MOJO_RESULT_OK) {  // success
       remaining_size_ -= length;
       head_ += length;
       if (remaining_size_ == 0)
         OnSuccess();
+      else
+        handle_watcher_.ArmOrNotify();
     } else if (result == MOJO_RESULT_SHOULD_WAIT) {  // IO pending
       handle_watcher_.ArmOrNotify();
     } else {  // error
@@ -105,6 +152,12 @@ class DataPipeReader {
     // free memory when JS buffer gets garbage collected.
     v8::Locker locker(promise_.isolate());
     v8::HandleScope handle_scope(promise_.isolate());
+    if (buffer_.empty()) {
+      promise_.Resolve(
+          node::Buffer::New(promise_.isolate(), 0).ToLocalChecked());
+      delete this;
+      return;
+    }
     v8::Local<v8::Value> buffer =
         node::Buffer::New(promise_.isolate(), &buffer_.front(), buffer_.size(),
                           &DataPipeReader::FreeBuffer, this)
@@ -125,6 +178,11 @@ class DataPipeReader {
 
   mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter_;
   mojo::ScopedDataPipeConsumerHandle data_pipe_;
+
+  // The requested range, clamped once the size of the data is known.
+  uint64_t offset_;
+  uint64_t length_;
+
   mojo::SimpleWatcher handle_watcher_;
 
   // Stores read data.
@@ -133,6 +191,9 @@ class DataPipeReader {
   // The head of buffer.
   char* head_ = nullptr;
 
+  // Data before the requested range that still has to be discarded.
+  uint64_t bytes_to_skip_ = 0;
+
   // Remaining data to read.
   uint64_t remaining_size_ = 0;
 
@@ -143,6 +204,183 @@ class DataPipeReader {
 
 }  // namespace
 
+gin::WrapperInfo BlobDataReader::kWrapperInfo = {gin::kEmbedderNativeGin};
+
+BlobDataReader::BlobDataReader(
+    mojo::PendingRemote<network::mojom::DataPipeGetter> data_pipe_getter,
+    uint64_t offset,
+    uint64_t length)
+    : data_pipe_getter_(std::move(data_pipe_getter)),
+      handle_watcher_(FROM_HERE,
+                      mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+                      base::SequencedTaskRunnerHandle::Get()),
+      offset_(offset),
+      length_(length) {
+  mojo::ScopedDataPipeProducerHandle producer_handle;
+  CHECK_EQ(mojo::CreateDataPipe(nullptr, producer_handle, data_pipe_),
+           MOJO_RESULT_OK);
+  data_pipe_getter_->Read(std::move(producer_handle),
+                          base::BindOnce(&BlobDataReader::ReadCallback,
+                                         weak_factory_.GetWeakPtr()));
+  handle_watcher_.Watch(data_pipe_.get(), MOJO_HANDLE_SIGNAL_READABLE,
+                        base::BindRepeating(&BlobDataReader::OnHandleReadable,
+                                            weak_factory_.GetWeakPtr()));
+}
+
+BlobDataReader::~BlobDataReader() = default;
+
+// static
+gin::Handle<BlobDataReader> BlobDataReader::Create(
+    v8::Isolate* isolate,
+    mojo::PendingRemote<network::mojom::DataPipeGetter> data_pipe_getter,
+    uint64_t offset,
+    uint64_t length) {
+  return gin::CreateHandle(
+      isolate, new BlobDataReader(std::move(data_pipe_getter), offset, length));
+}
+
+v8::Local<v8::Promise> BlobDataReader::Read(v8::Isolate* isolate) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (pending_read_) {
+    promise.RejectWithErrorMessage("A read is already in progress");
+    return handle;
+  }
+  if (failed_) {
+    promise.RejectWithErrorMessage("Could not get blob data");
+    return handle;
+  }
+  if (!data_pipe_) {
+    promise.Resolve(v8::Null(isolate));
+    return handle;
+  }
+
+  pending_read_ = std::move(promise);
+  // Until the size is known the range cannot be located, ReadCallback arms
+  // the watcher once it is.
+  if (size_known_)
+    handle_watcher_.ArmOrNotify();
+  return handle;
+}
+
+void BlobDataReader::Cancel() {
+  Reset();
+  if (pending_read_) {
+    v8::Isolate* isolate = pending_read_->isolate();
+    v8::Locker locker(isolate);
+    v8::HandleScope handle_scope(isolate);
+    ResolvePendingRead(v8::Null(isolate));
+  }
+}
+
+void BlobDataReader::ReadCallback(int32_t status, uint64_t size) {
+  if (status != net::OK) {
+    OnFailure();
+    return;
+  }
+  ClampRange(size, &offset_, &length_);
+  bytes_to_skip_ = offset_;
+  remaining_size_ = length_;
+  size_known_ = true;
+  if (remaining_size_ == 0) {
+    Cancel();
+    return;
+  }
+  if (pending_read_)
+    handle_watcher_.ArmOrNotify();
+}
+
+void BlobDataReader::OnHandleReadable(MojoResult result) {
+  if (!pending_read_)
+    return;
+
+  v8::Isolate* isolate = pending_read_->isolate();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+
+  if (!data_pipe_) {
+    ResolvePendingRead(v8::Null(isolate));
+    return;
+  }
+  if (result != MOJO_RESULT_OK) {
+    OnFailure();
+    return;
+  }
+
+  // Skip the bytes before the requested range.
+  while (bytes_to_skip_ > 0) {
+    result = SkipData(data_pipe_, &bytes_to_skip_);
+    if (result == MOJO_RESULT_SHOULD_WAIT) {
+      handle_watcher_.ArmOrNotify();
+      return;
+    }
+    if (result != MOJO_RESULT_OK) {
+      OnFailure();
+      return;
+    }
+  }
+
+  // Copy at most one chunk straight out of the pipe's buffer.
+  const void* data = nullptr;
+  uint32_t available = 0;
+  result =
+      data_pipe_->BeginReadData(&data, &available, MOJO_READ_DATA_FLAG_NONE);
+  if (result == MOJO_RESULT_SHOULD_WAIT) {
+    handle_watcher_.ArmOrNotify();
+    return;
+  }
+  if (result != MOJO_RESULT_OK) {
+    OnFailure();
+    return;
+  }
+  uint32_t length = static_cast<uint32_t>(std::min<uint64_t>(
+      std::min(available, kReadChunkSize), remaining_size_));
+  v8::Local<v8::Value> chunk =
+      node::Buffer::Copy(isolate, static_cast<const char*>(data), length)
+          .ToLocalChecked();
+  data_pipe_->EndReadData(length);
+
+  remaining_size_ -= length;
+  if (remaining_size_ == 0)
+    Reset();
+  ResolvePendingRead(chunk);
+}
+
+void BlobDataReader::ResolvePendingRead(v8::Local<v8::Value> value) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise =
+      std::move(*pending_read_);
+  pending_read_.reset();
+  promise.Resolve(value);
+}
+
+void BlobDataReader::OnFailure() {
+  failed_ = true;
+  Reset();
+  if (pending_read_) {
+    gin_helper::Promise<v8::Local<v8::Value>> promise =
+        std::move(*pending_read_);
+    pending_read_.reset();
+    promise.RejectWithErrorMessage("Could not get blob data");
+  }
+}
+
+void BlobDataReader::Reset() {
+  handle_watcher_.Cancel();
+  data_pipe_.reset();
+  data_pipe_getter_.reset();
+}
+
+gin::ObjectTemplateBuilder BlobDataReader::GetObjectTemplateBuilder(
+    v8::Isolate* isolate) {
+  return gin::Wrappable<BlobDataReader>::GetObjectTemplateBuilder(isolate)
+      .SetMethod("read", &BlobDataReader::Read)
+      .SetMethod("cancel", &BlobDataReader::Cancel);
+}
+
+const char* BlobDataReader::GetTypeName() {
+  return "BlobDataReader";
+}
+
 gin::WrapperInfo DataPipeHolder::kWrapperInfo = {gin::kEmbedderNativeGin};
 
 DataPipeHolder::DataPipeHolder(const network::DataElement& element)
@@ -153,7 +391,16 @@ DataPipeHolder::DataPipeHolder(const network::DataElement& element)
 
 DataPipeHolder::~DataPipeHolder() = default;
 
-v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
+mojo::PendingRemote<network::mojom::DataPipeGetter>
+DataPipeHolder::CloneDataPipe() {
+  mojo::PendingRemote<network::mojom::DataPipeGetter> data_pipe_getter;
+  data_pipe_->Clone(data_pipe_getter.InitWithNewPipeAndPassReceiver());
+  return data_pipe_getter;
+}
+
+v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate,
+                                               uint64_t offset,
+                                               uint64_t length) {
   gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
   if (!data_pipe_) {
@@ -161,10 +408,16 @@ v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
     return handle;
   }
 
-  new DataPipeReader(std::move(promise), std::move(data_pipe_));
+  new DataPipeReader(std::move(promise), CloneDataPipe(), offset, length);
   return handle;
 }
 
+gin::Handle<BlobDataReader> DataPipeHolder::CreateReader(v8::Isolate* isolate,
+                                                         uint64_t offset,
+                                                         uint64_t length) {
+  return BlobDataReader::Create(isolate, CloneDataPipe(), offset, length);
+}
+
 // static
 gin::Handle<DataPipeHolder> DataPipeHolder::Create(
     v8::Isolate* isolate,
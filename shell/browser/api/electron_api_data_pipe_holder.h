@@ -7,16 +7,81 @@
 
 #include <string>
 
+#include "base/memory/weak_ptr.h"
+#include "base/optional.h"
 #include "gin/handle.h"
 #include "gin/wrappable.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/simple_watcher.h"
 #include "services/network/public/cpp/data_element.h"
 #include "services/network/public/mojom/data_pipe_getter.mojom.h"
+#include "shell/common/gin_helper/promise.h"
 
 namespace electron {
 
 namespace api {
 
+// Reads a byte range of a data pipe one chunk at a time, and only when JS asks
+// for the next chunk, so memory use is bounded by the chunk size rather than
+// by the size of the blob.
+class BlobDataReader : public gin::Wrappable<BlobDataReader> {
+ public:
+  static gin::WrapperInfo kWrapperInfo;
+
+  static gin::Handle<BlobDataReader> Create(
+      v8::Isolate* isolate,
+      mojo::PendingRemote<network::mojom::DataPipeGetter> data_pipe_getter,
+      uint64_t offset,
+      uint64_t length);
+
+  // Resolves with the next chunk, or null once the range has been read.
+  v8::Local<v8::Promise> Read(v8::Isolate* isolate);
+
+  // Stops reading and releases the data pipe.
+  void Cancel();
+
+  // gin::Wrappable
+  gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
+      v8::Isolate* isolate) override;
+  const char* GetTypeName() override;
+
+ private:
+  BlobDataReader(
+      mojo::PendingRemote<network::mojom::DataPipeGetter> data_pipe_getter,
+      uint64_t offset,
+      uint64_t length);
+  ~BlobDataReader() override;
+
+  // Callback invoked by DataPipeGetter::Read.
+  void ReadCallback(int32_t status, uint64_t size);
+  void OnHandleReadable(MojoResult result);
+
+  void ResolvePendingRead(v8::Local<v8::Value> value);
+  void OnFailure();
+  void Reset();
+
+  mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter_;
+  mojo::ScopedDataPipeConsumerHandle data_pipe_;
+  mojo::SimpleWatcher handle_watcher_;
+
+  base::Optional<gin_helper::Promise<v8::Local<v8::Value>>> pending_read_;
+
+  // The requested range, clamped once the size of the data is known.
+  uint64_t offset_;
+  uint64_t length_;
+
+  bool size_known_ = false;
+  bool failed_ = false;
+  uint64_t bytes_to_skip_ = 0;
+  uint64_t remaining_size_ = 0;
+
+  base::WeakPtrFactory<BlobDataReader> weak_factory_{this};
+
+  DISALLOW_COPY_AND_ASSIGN(BlobDataReader);
+};
+
 // Retains reference to the data pipe.
 class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
  public:
@@ -28,11 +93,17 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   static gin::Handle<DataPipeHolder> From(v8::Isolate* isolate,
                                           const std::string& id);
 
-  // Read all data at once.
+  // Read all data, or the |length| bytes starting at |offset|, at once.
   //
-  // TODO(zcbenz): This is apparently not suitable for really large data, but
-  // no one has complained about it yet.
-  v8::Local<v8::Promise> ReadAll(v8::Isolate* isolate);
+  // This is not suitable for really large data, use CreateReader instead.
+  v8::Local<v8::Promise> ReadAll(v8::Isolate* isolate,
+                                 uint64_t offset,
+                                 uint64_t length);
+
+  // Create a reader that yields the same range in chunks on demand.
+  gin::Handle<BlobDataReader> CreateReader(v8::Isolate* isolate,
+                                           uint64_t offset,
+                                           uint64_t length);
 
   // The unique ID that can be used to receive the object.
   const std::string& id() const { return id_; }
@@ -41,6 +112,10 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   explicit DataPipeHolder(const network::DataElement& element);
   ~DataPipeHolder() override;
 
+  // Every read works on its own clone of the getter, so the same blob can be
+  // read more than once, e.g. one range at a time.
+  mojo::PendingRemote<network::mojom::DataPipeGetter> CloneDataPipe();
+
   std::string id_;
   mojo::Remote<network::mojom::DataPipeGetter> data_pipe_;
 
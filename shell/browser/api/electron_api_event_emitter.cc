@@ -7,8 +7,10 @@
 #include "base/bind.h"
 #include "base/callback.h"
 #include "base/no_destructor.h"
+#include "gin/converter.h"
 #include "gin/dictionary.h"
 #include "shell/common/gin_converters/callback_converter.h"
+#include "shell/common/gin_helper/event_emitter_caller.h"
 #include "shell/common/node_includes.h"
 #include "v8/include/v8.h"
 
@@ -22,6 +24,14 @@ v8::Global<v8::Object>* GetEventEmitterPrototypeReference() {
 void SetEventEmitterPrototype(v8::Isolate* isolate,
                               v8::Local<v8::Object> proto) {
   GetEventEmitterPrototypeReference()->Reset(isolate, proto);
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Value> emit;
+  if (proto->Get(context, gin::StringToSymbol(isolate, "emit"))
+          .ToLocal(&emit) &&
+      emit->IsFunction()) {
+    gin_helper::SetEventEmitterEmit(isolate, emit);
+  }
 }
 
 void Initialize(v8::Local<v8::Object> exports,
@@ -85,36 +85,51 @@ bool InvokeBoolMethod(const Menu* menu,
 }
 
 bool Menu::IsCommandIdChecked(int command_id) const {
-  return InvokeBoolMethod(this, "_isCommandIdChecked", command_id);
+  const auto* state = model_->GetItemState(command_id);
+  if (!state)
+    return false;
+  if (state->dynamic_checked)
+    return InvokeBoolMethod(this, "_isCommandIdChecked", command_id);
+  return state->checked;
 }
 
 bool Menu::IsCommandIdEnabled(int command_id) const {
-  return InvokeBoolMethod(this, "_isCommandIdEnabled", command_id);
+  const auto* state = model_->GetItemState(command_id);
+  return state && state->enabled;
 }
 
 bool Menu::IsCommandIdVisible(int command_id) const {
-  return InvokeBoolMethod(this, "_isCommandIdVisible", command_id);
+  const auto* state = model_->GetItemState(command_id);
+  return state && state->visible;
 }
 
 bool Menu::ShouldCommandIdWorkWhenHidden(int command_id) const {
-  return InvokeBoolMethod(this, "_shouldCommandIdWorkWhenHidden", command_id);
+  const auto* state = model_->GetItemState(command_id);
+  return state && state->works_when_hidden;
 }
 
 bool Menu::GetAcceleratorForCommandIdWithParams(
     int command_id,
     bool use_default_accelerator,
     ui::Accelerator* accelerator) const {
-  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
-  v8::HandleScope scope(isolate);
-  v8::Local<v8::Value> val = gin_helper::CallMethod(
-      isolate, const_cast<Menu*>(this), "_getAcceleratorForCommandId",
-      command_id, use_default_accelerator);
-  return gin::ConvertFromV8(isolate, val, accelerator);
+  const auto* state = model_->GetItemState(command_id);
+  if (!state)
+    return false;
+  if (state->has_accelerator) {
+    if (!state->accelerator)
+      return false;
+    *accelerator = *state->accelerator;
+    return true;
+  }
+  if (!use_default_accelerator || !state->default_accelerator)
+    return false;
+  *accelerator = *state->default_accelerator;
+  return true;
 }
 
 bool Menu::ShouldRegisterAcceleratorForCommandId(int command_id) const {
-  return InvokeBoolMethod(this, "_shouldRegisterAcceleratorForCommandId",
-                          command_id);
+  const auto* state = model_->GetItemState(command_id);
+  return state && state->register_accelerator;
 }
 
 #if defined(OS_MAC)
@@ -192,6 +207,43 @@ void Menu::InsertSubMenuAt(int index,
   model_->InsertSubMenuAt(index, command_id, label, menu->model_.get());
 }
 
+void Menu::SetItemState(v8::Isolate* isolate,
+                        int command_id,
+                        const gin_helper::Dictionary& changes) {
+  // Only the properties that changed are passed, apply them on top of the
+  // current state.
+  const auto* current = model_->GetItemState(command_id);
+  ElectronMenuModel::ItemState state =
+      current ? *current : ElectronMenuModel::ItemState();
+  changes.Get("checked", &state.checked);
+  changes.Get("dynamicChecked", &state.dynamic_checked);
+  changes.Get("enabled", &state.enabled);
+  changes.Get("visible", &state.visible);
+  changes.Get("acceleratorWorksWhenHidden", &state.works_when_hidden);
+  changes.Get("registerAccelerator", &state.register_accelerator);
+
+  v8::Local<v8::Value> value;
+  if (changes.Get("accelerator", &value)) {
+    state.has_accelerator = !value->IsNullOrUndefined();
+    ui::Accelerator accelerator;
+    if (state.has_accelerator &&
+        gin::ConvertFromV8(isolate, value, &accelerator))
+      state.accelerator = accelerator;
+    else
+      state.accelerator.reset();
+  }
+  if (changes.Get("defaultAccelerator", &value)) {
+    ui::Accelerator accelerator;
+    if (!value->IsNullOrUndefined() &&
+        gin::ConvertFromV8(isolate, value, &accelerator))
+      state.default_accelerator = accelerator;
+    else
+      state.default_accelerator.reset();
+  }
+
+  model_->SetItemState(command_id, state);
+}
+
 void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, ui::ImageModel::FromImage(image));
 }
@@ -278,6 +330,7 @@ v8::Local<v8::ObjectTemplate> Menu::FillObjectTemplate(
       .SetMethod("insertRadioItem", &Menu::InsertRadioItemAt)
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
+      .SetMethod("_setItemState", &Menu::SetItemState)
       .SetMethod("setIcon", &Menu::SetIcon)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setToolTip", &Menu::SetToolTip)
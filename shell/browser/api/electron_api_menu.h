@@ -16,6 +16,10 @@
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/pinnable.h"
 
+namespace gin_helper {
+class Dictionary;
+}
+
 namespace electron {
 
 namespace api {
@@ -101,6 +105,9 @@ class Menu : public gin::Wrappable<Menu>,
                        int command_id,
                        const std::u16string& label,
                        Menu* menu);
+  void SetItemState(v8::Isolate* isolate,
+                    int command_id,
+                    const gin_helper::Dictionary& changes);
   void SetIcon(int index, const gfx::Image& image);
   void SetSublabel(int index, const std::u16string& sublabel);
   void SetToolTip(int index, const std::u16string& toolTip);
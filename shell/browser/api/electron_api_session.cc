@@ -5,6 +5,8 @@
 #include "shell/browser/api/electron_api_session.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -54,6 +56,7 @@
 #include "shell/browser/api/electron_api_service_worker_context.h"
 #include "shell/browser/api/electron_api_web_request.h"
 #include "shell/browser/browser.h"
+#include "shell/browser/electron_browser_client.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/browser/electron_permission_manager.h"
@@ -68,6 +71,8 @@
 #include "shell/common/gin_converters/net_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/gin_helper/error_thrower.h"
+#include "shell/common/gin_helper/locker.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
@@ -182,6 +187,27 @@ struct Converter<ClearStorageDataOptions> {
   }
 };
 
+template <>
+struct Converter<electron::ElectronPermissionManager::CheckResult> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::ElectronPermissionManager::CheckResult* out) {
+    // Handlers may return either a boolean or { granted, cacheTTL }. Any
+    // other value, including a Promise from an async handler, keeps being
+    // judged by its truthiness.
+    gin_helper::Dictionary result;
+    if (val->IsObject() && ConvertFromV8(isolate, val, &result) &&
+        result.Get("granted", &out->granted)) {
+      double cache_ttl = 0;
+      if (result.Get("cacheTTL", &cache_ttl) && cache_ttl > 0)
+        out->cache_ttl = base::TimeDelta::FromMillisecondsD(cache_ttl);
+      return true;
+    }
+    out->granted = val->BooleanValue(isolate);
+    return true;
+  }
+};
+
 bool SSLProtocolVersionFromString(const std::string& version_str,
                                   network::mojom::SSLVersion* version) {
   if (version_str == switches::kSSLVersionTLSv12) {
@@ -252,6 +278,17 @@ namespace {
 
 const char kPersistPrefix[] = "persist:";
 
+// Splits |partition| into the name of its browser context and whether the
+// browser context is in memory.
+std::pair<std::string, bool> ParsePartition(const std::string& partition) {
+  if (partition.empty())
+    return {"", false};
+  if (base::StartsWith(partition, kPersistPrefix,
+                       base::CompareCase::SENSITIVE))
+    return {partition.substr(8), false};
+  return {partition, true};
+}
+
 void DownloadIdCallback(content::DownloadManager* download_manager,
                         const base::FilePath& path,
                         const std::vector<GURL>& url_chain,
@@ -272,6 +309,38 @@ void DownloadIdCallback(content::DownloadManager* download_manager,
       false, std::vector<download::DownloadItem::ReceivedSlice>());
 }
 
+bool GetBlobDataRangeField(gin::Arguments* args,
+                           const gin_helper::Dictionary& options,
+                           const char* name,
+                           uint64_t* out) {
+  v8::Local<v8::Value> value;
+  if (!options.Get(name, &value) || value->IsUndefined())
+    return true;
+  double number = 0;
+  if (!gin::ConvertFromV8(args->isolate(), value, &number) || number < 0 ||
+      number != std::floor(number)) {
+    args->ThrowTypeError(std::string(name) + " must be a non-negative integer");
+    return false;
+  }
+  *out = static_cast<uint64_t>(number);
+  return true;
+}
+
+// Reads the optional |{ offset, length }| range of a blob read. The range
+// defaults to the whole blob and is clamped to its size once that is known.
+bool GetBlobDataRange(gin::Arguments* args,
+                      uint64_t* offset,
+                      uint64_t* length) {
+  *offset = 0;
+  *length = std::numeric_limits<uint64_t>::max();
+
+  gin_helper::Dictionary options;
+  if (!args->GetNext(&options))
+    return true;
+  return GetBlobDataRangeField(args, options, "offset", offset) &&
+         GetBlobDataRangeField(args, options, "length", length);
+}
+
 #if BUILDFLAG(ENABLE_BUILTIN_SPELLCHECKER)
 class DictionaryObserver final : public SpellcheckCustomDictionary::Observer {
  private:
@@ -649,6 +718,12 @@ void Session::SetPermissionCheckHandler(v8::Local<v8::Value> val,
   permission_manager->SetPermissionCheckHandler(handler);
 }
 
+void Session::ClearPermissionCheckCache() {
+  auto* permission_manager = static_cast<ElectronPermissionManager*>(
+      browser_context()->GetPermissionControllerDelegate());
+  permission_manager->ClearPermissionCheckCache();
+}
+
 v8::Local<v8::Promise> Session::ClearHostResolverCache(gin::Arguments* args) {
   v8::Isolate* isolate = args->isolate();
   gin_helper::Promise<void> promise(isolate);
@@ -718,15 +793,39 @@ bool Session::IsPersistent() {
 }
 
 v8::Local<v8::Promise> Session::GetBlobData(v8::Isolate* isolate,
-                                            const std::string& uuid) {
+                                            const std::string& uuid,
+                                            gin::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  uint64_t offset, length;
+  if (!GetBlobDataRange(args, &offset, &length))
+    return handle;
+
   gin::Handle<DataPipeHolder> holder = DataPipeHolder::From(isolate, uuid);
   if (holder.IsEmpty()) {
-    gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
     promise.RejectWithErrorMessage("Could not get blob data handle");
-    return promise.GetHandle();
+    return handle;
   }
 
-  return holder->ReadAll(isolate);
+  return holder->ReadAll(isolate, offset, length);
+}
+
+v8::Local<v8::Value> Session::GetBlobDataReader(v8::Isolate* isolate,
+                                                const std::string& uuid,
+                                                gin::Arguments* args) {
+  uint64_t offset, length;
+  if (!GetBlobDataRange(args, &offset, &length))
+    return v8::Null(isolate);
+
+  gin::Handle<DataPipeHolder> holder = DataPipeHolder::From(isolate, uuid);
+  if (holder.IsEmpty()) {
+    gin_helper::ErrorThrower(isolate).ThrowError(
+        "Could not get blob data handle");
+    return v8::Null(isolate);
+  }
+
+  return holder->CreateReader(isolate, offset, length).ToV8();
 }
 
 void Session::DownloadURL(const GURL& url) {
@@ -780,6 +879,10 @@ std::vector<base::FilePath> Session::GetPreloads() const {
   return prefs->preloads();
 }
 
+void Session::WarmUpRendererProcess() {
+  ElectronBrowserClient::Get()->WarmUpSpareRendererProcess(browser_context());
+}
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 v8::Local<v8::Promise> Session::LoadExtension(
     const base::FilePath& extension_path,
@@ -1120,22 +1223,23 @@ gin::Handle<Session> Session::CreateFrom(
 gin::Handle<Session> Session::FromPartition(v8::Isolate* isolate,
                                             const std::string& partition,
                                             base::DictionaryValue options) {
-  ElectronBrowserContext* browser_context;
-  if (partition.empty()) {
-    browser_context =
-        ElectronBrowserContext::From("", false, std::move(options));
-  } else if (base::StartsWith(partition, kPersistPrefix,
-                              base::CompareCase::SENSITIVE)) {
-    std::string name = partition.substr(8);
-    browser_context =
-        ElectronBrowserContext::From(name, false, std::move(options));
-  } else {
-    browser_context =
-        ElectronBrowserContext::From(partition, true, std::move(options));
-  }
+  auto name_and_in_memory = ParsePartition(partition);
+  ElectronBrowserContext* browser_context = ElectronBrowserContext::From(
+      name_and_in_memory.first, name_and_in_memory.second, std::move(options));
   return CreateFrom(isolate, browser_context);
 }
 
+// static
+void Session::FromPartitionAsync(
+    const std::string& partition,
+    base::DictionaryValue options,
+    base::OnceCallback<void(ElectronBrowserContext*)> callback) {
+  auto name_and_in_memory = ParsePartition(partition);
+  ElectronBrowserContext::FromAsync(
+      name_and_in_memory.first, name_and_in_memory.second, std::move(options),
+      std::move(callback));
+}
+
 gin::ObjectTemplateBuilder Session::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin_helper::EventEmitterMixin<Session>::GetObjectTemplateBuilder(
@@ -1155,6 +1259,8 @@ gin::ObjectTemplateBuilder Session::GetObjectTemplateBuilder(
                  &Session::SetPermissionRequestHandler)
       .SetMethod("setPermissionCheckHandler",
                  &Session::SetPermissionCheckHandler)
+      .SetMethod("clearPermissionCheckCache",
+                 &Session::ClearPermissionCheckCache)
       .SetMethod("clearHostResolverCache", &Session::ClearHostResolverCache)
       .SetMethod("clearAuthCache", &Session::ClearAuthCache)
       .SetMethod("allowNTLMCredentialsForDomains",
@@ -1164,11 +1270,13 @@ gin::ObjectTemplateBuilder Session::GetObjectTemplateBuilder(
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("setSSLConfig", &Session::SetSSLConfig)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("getBlobDataReader", &Session::GetBlobDataReader)
       .SetMethod("downloadURL", &Session::DownloadURL)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
       .SetMethod("setPreloads", &Session::SetPreloads)
       .SetMethod("getPreloads", &Session::GetPreloads)
+      .SetMethod("warmUpRendererProcess", &Session::WarmUpRendererProcess)
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
       .SetMethod("loadExtension", &Session::LoadExtension)
       .SetMethod("removeExtension", &Session::RemoveExtension)
@@ -1231,6 +1339,33 @@ v8::Local<v8::Value> FromPartition(const std::string& partition,
       .ToV8();
 }
 
+void OnFromPartitionAsync(gin_helper::Promise<gin::Handle<Session>> promise,
+                          ElectronBrowserContext* browser_context) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+  promise.Resolve(Session::CreateFrom(isolate, browser_context));
+}
+
+v8::Local<v8::Promise> FromPartitionAsync(const std::string& partition,
+                                          gin::Arguments* args) {
+  gin_helper::Promise<gin::Handle<Session>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!electron::Browser::Get()->is_ready()) {
+    promise.RejectWithErrorMessage(
+        "Session can only be received when app is ready");
+    return handle;
+  }
+  base::DictionaryValue options;
+  args->GetNext(&options);
+  Session::FromPartitionAsync(
+      partition, std::move(options),
+      base::BindOnce(&OnFromPartitionAsync, std::move(promise)));
+  return handle;
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -1238,6 +1373,7 @@ void Initialize(v8::Local<v8::Object> exports,
   v8::Isolate* isolate = context->GetIsolate();
   gin_helper::Dictionary dict(isolate, exports);
   dict.SetMethod("fromPartition", &FromPartition);
+  dict.SetMethod("fromPartitionAsync", &FromPartitionAsync);
 }
 
 }  // namespace
@@ -80,6 +80,13 @@ class Session : public gin::Wrappable<Session>,
       const std::string& partition,
       base::DictionaryValue options = base::DictionaryValue());
 
+  // Like FromPartition, but a new partition's preferences are read off the
+  // UI thread. |callback| is run on the UI thread.
+  static void FromPartitionAsync(
+      const std::string& partition,
+      base::DictionaryValue options,
+      base::OnceCallback<void(ElectronBrowserContext*)> callback);
+
   ElectronBrowserContext* browser_context() const { return browser_context_; }
 
   // gin::Wrappable
@@ -104,6 +111,7 @@ class Session : public gin::Wrappable<Session>,
                                    gin::Arguments* args);
   void SetPermissionCheckHandler(v8::Local<v8::Value> val,
                                  gin::Arguments* args);
+  void ClearPermissionCheckCache();
   v8::Local<v8::Promise> ClearHostResolverCache(gin::Arguments* args);
   v8::Local<v8::Promise> ClearAuthCache();
   void AllowNTLMCredentialsForDomains(const std::string& domains);
@@ -112,11 +120,16 @@ class Session : public gin::Wrappable<Session>,
   void SetSSLConfig(network::mojom::SSLConfigPtr config);
   bool IsPersistent();
   v8::Local<v8::Promise> GetBlobData(v8::Isolate* isolate,
-                                     const std::string& uuid);
+                                     const std::string& uuid,
+                                     gin::Arguments* args);
+  v8::Local<v8::Value> GetBlobDataReader(v8::Isolate* isolate,
+                                         const std::string& uuid,
+                                         gin::Arguments* args);
   void DownloadURL(const GURL& url);
   void CreateInterruptedDownload(const gin_helper::Dictionary& options);
   void SetPreloads(const std::vector<base::FilePath>& preloads);
   std::vector<base::FilePath> GetPreloads() const;
+  void WarmUpRendererProcess();
   v8::Local<v8::Value> Cookies(v8::Isolate* isolate);
   v8::Local<v8::Value> Protocol(v8::Isolate* isolate);
   v8::Local<v8::Value> ServiceWorkerContext(v8::Isolate* isolate);
@@ -118,6 +118,7 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/heap_snapshot.h"
 #include "shell/common/language_util.h"
 #include "shell/common/mouse_util.h"
 #include "shell/common/node_includes.h"
@@ -762,7 +763,13 @@ WebContents::WebContents(v8::Isolate* isolate,
   } else {
     content::WebContents::CreateParams params(session->browser_context());
     params.initially_hidden = !initially_shown;
+    // Let the first process allocation take over the session's spare renderer
+    // when it was launched with the same switches this one would get.
+    auto* browser_client = ElectronBrowserClient::Get();
+    browser_client->set_spare_renderer_allowed(
+        WebContentsPreferences::CanUseSpareRenderer(options));
     web_contents = content::WebContents::Create(params);
+    browser_client->set_spare_renderer_allowed(false);
   }
 
   InitWithSessionAndOptions(isolate, std::move(web_contents), session, options);
@@ -2654,12 +2661,15 @@ void WebContents::Print(gin::Arguments* args) {
                      std::move(callback), device_name, silent));
 }
 
-v8::Local<v8::Promise> WebContents::PrintToPDF(base::DictionaryValue settings) {
+v8::Local<v8::Promise> WebContents::PrintToPDF(base::DictionaryValue settings,
+                                               gin::Arguments* args) {
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
+  base::FilePath output_path;
+  args->GetNext(&output_path);
   PrintPreviewMessageHandler::FromWebContents(web_contents())
-      ->PrintToPDF(std::move(settings), std::move(promise));
+      ->PrintToPDF(std::move(settings), output_path, std::move(promise));
   return handle;
 }
 #endif
@@ -3249,10 +3259,22 @@ v8::Local<v8::Promise> WebContents::GetProcessMemoryInfo(v8::Isolate* isolate) {
 
 v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
     v8::Isolate* isolate,
-    const base::FilePath& file_path) {
+    const base::FilePath& file_path,
+    gin::Arguments* args) {
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
+  HeapSnapshotCompression compression = HeapSnapshotCompression::kNone;
+  gin_helper::Dictionary options;
+  v8::Local<v8::Value> value;
+  if (args->GetNext(&options) && options.Get("compression", &value) &&
+      !value->IsUndefined() &&
+      !gin::ConvertFromV8(isolate, value, &compression)) {
+    promise.RejectWithErrorMessage(
+        "Invalid compression, expected 'none' or 'gzip'");
+    return handle;
+  }
+
   base::ThreadRestrictions::ScopedAllowIO allow_io;
   base::File file(file_path,
                   base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
@@ -3282,6 +3304,7 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
   auto* raw_ptr = electron_renderer.get();
   (*raw_ptr)->TakeHeapSnapshot(
       mojo::WrapPlatformFile(base::ScopedPlatformFile(file.TakePlatformFile())),
+      compression == HeapSnapshotCompression::kGzip,
       base::BindOnce(
           [](mojo::Remote<mojom::ElectronRenderer>* ep,
              gin_helper::Promise<void> promise, bool success) {
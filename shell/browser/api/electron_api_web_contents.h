@@ -227,7 +227,8 @@ class WebContents : public gin::Wrappable<WebContents>,
                            std::u16string default_printer);
   void Print(gin::Arguments* args);
   // Print current page as PDF.
-  v8::Local<v8::Promise> PrintToPDF(base::DictionaryValue settings);
+  v8::Local<v8::Promise> PrintToPDF(base::DictionaryValue settings,
+                                    gin::Arguments* args);
 #endif
 
   void SetNextChildWebPreferences(const gin_helper::Dictionary);
@@ -328,7 +329,8 @@ class WebContents : public gin::Wrappable<WebContents>,
   void NotifyUserActivation();
 
   v8::Local<v8::Promise> TakeHeapSnapshot(v8::Isolate* isolate,
-                                          const base::FilePath& file_path);
+                                          const base::FilePath& file_path,
+                                          gin::Arguments* args);
   v8::Local<v8::Promise> GetProcessMemoryInfo(v8::Isolate* isolate);
 
   // Properties.
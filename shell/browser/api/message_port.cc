@@ -4,6 +4,8 @@
 
 #include "shell/browser/api/message_port.h"
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -13,6 +15,7 @@
 #include "gin/data_object_builder.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
@@ -25,6 +28,79 @@
 
 namespace electron {
 
+namespace {
+
+// Walks the transfer list the way blink does before serializing, so that a
+// message which will be rejected never detaches any of the caller's buffers.
+// Buffers node has marked as untransferable, like the pool shared by small
+// Buffers, are refused the same way node's own MessagePort does.
+bool ValidateArrayBuffers(
+    v8::Isolate* isolate,
+    const std::vector<v8::Local<v8::ArrayBuffer>>& array_buffers) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  node::Environment* env = node::Environment::GetCurrent(isolate);
+  for (size_t i = 0; i < array_buffers.size(); ++i) {
+    const auto& array_buffer = array_buffers[i];
+    std::string problem;
+    if (std::find(array_buffers.begin(), array_buffers.begin() + i,
+                  array_buffer) != array_buffers.begin() + i)
+      problem = "a duplicate of an earlier ArrayBuffer";
+    else if (!array_buffer->IsDetachable())
+      problem = "not detachable";
+    else if (env &&
+             array_buffer
+                 ->HasPrivate(context,
+                              env->untransferable_object_private_symbol())
+                 .FromMaybe(true))
+      problem = "marked as untransferable";
+    if (!problem.empty()) {
+      gin_helper::ErrorThrower(isolate).ThrowError(
+          "ArrayBuffer at index " + base::NumberToString(i) + " is " +
+          problem + ".");
+      return false;
+    }
+  }
+  return true;
+}
+
+// Copies the contents of each buffer into the message and detaches it, so the
+// sender observes the same neutering as with a DOM MessagePort. Large buffers
+// land directly in shared memory, so this is the only copy on the send side.
+std::vector<mojo_base::BigBuffer> DetachArrayBuffers(
+    const std::vector<v8::Local<v8::ArrayBuffer>>& array_buffers) {
+  std::vector<mojo_base::BigBuffer> contents;
+  contents.reserve(array_buffers.size());
+  for (const auto& array_buffer : array_buffers) {
+    std::shared_ptr<v8::BackingStore> backing_store =
+        array_buffer->GetBackingStore();
+    contents.emplace_back(base::make_span(
+        static_cast<const uint8_t*>(backing_store->Data()),
+        backing_store->ByteLength()));
+    array_buffer->Detach();
+  }
+  return contents;
+}
+
+// Wraps received contents in an ArrayBuffer without copying them; the
+// BigBuffer (and any shared memory mapping behind it) is released when V8
+// frees the backing store.
+v8::Local<v8::ArrayBuffer> AdoptArrayBuffer(v8::Isolate* isolate,
+                                            mojo_base::BigBuffer contents) {
+  if (contents.size() == 0)
+    return v8::ArrayBuffer::New(isolate, 0);
+  auto* owned_contents = new mojo_base::BigBuffer(std::move(contents));
+  std::unique_ptr<v8::BackingStore> backing_store =
+      v8::ArrayBuffer::NewBackingStore(
+          owned_contents->data(), owned_contents->size(),
+          [](void*, size_t, void* deleter_data) {
+            delete static_cast<mojo_base::BigBuffer*>(deleter_data);
+          },
+          owned_contents);
+  return v8::ArrayBuffer::New(isolate, std::move(backing_store));
+}
+
+}  // namespace
+
 gin::WrapperInfo MessagePort::kWrapperInfo = {gin::kEmbedderNativeGin};
 
 MessagePort::MessagePort() = default;
@@ -54,16 +130,27 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     return;
   }
 
-  electron::SerializeV8Value(args->isolate(), message_value,
-                             &transferable_message);
-
   v8::Local<v8::Value> transferables;
   std::vector<gin::Handle<MessagePort>> wrapped_ports;
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
   if (args->GetNext(&transferables)) {
-    if (!gin::ConvertFromV8(args->isolate(), transferables, &wrapped_ports)) {
+    std::vector<v8::Local<v8::Value>> transfer_list;
+    if (!gin::ConvertFromV8(args->isolate(), transferables, &transfer_list)) {
       args->ThrowError();
       return;
     }
+    for (auto transferable : transfer_list) {
+      if (transferable->IsArrayBuffer()) {
+        array_buffers.push_back(transferable.As<v8::ArrayBuffer>());
+        continue;
+      }
+      gin::Handle<MessagePort> port;
+      if (!gin::ConvertFromV8(args->isolate(), transferable, &port)) {
+        args->ThrowError();
+        return;
+      }
+      wrapped_ports.push_back(port);
+    }
   }
 
   // Make sure we aren't connected to any of the passed-in ports.
@@ -76,12 +163,22 @@ void MessagePort::PostMessage(gin::Arguments* args) {
     }
   }
 
+  if (!ValidateArrayBuffers(args->isolate(), array_buffers))
+    return;
+
+  if (!electron::SerializeV8Value(args->isolate(), message_value,
+                                  array_buffers, &transferable_message))
+    return;
+
   bool threw_exception = false;
   transferable_message.ports = MessagePort::DisentanglePorts(
       args->isolate(), wrapped_ports, &threw_exception);
   if (threw_exception)
     return;
 
+  transferable_message.array_buffer_contents_array =
+      DetachArrayBuffers(array_buffers);
+
   mojo::Message mojo_message = blink::mojom::TransferableMessage::WrapAsMessage(
       std::move(transferable_message));
   connector_->Accept(&mojo_message);
@@ -237,7 +334,13 @@ bool MessagePort::Accept(mojo::Message* mojo_message) {
 
   auto ports = EntanglePorts(isolate, std::move(message.ports));
 
-  v8::Local<v8::Value> message_value = DeserializeV8Value(isolate, message);
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  array_buffers.reserve(message.array_buffer_contents_array.size());
+  for (auto& contents : message.array_buffer_contents_array)
+    array_buffers.push_back(AdoptArrayBuffer(isolate, std::move(contents)));
+
+  v8::Local<v8::Value> message_value =
+      DeserializeV8Value(isolate, message, array_buffers);
 
   v8::Local<v8::Object> self;
   if (!GetWrapper(isolate).ToLocal(&self))
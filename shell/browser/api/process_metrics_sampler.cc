@@ -0,0 +1,198 @@
+// Copyright (c) 2021 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/process_metrics_sampler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+
+#if defined(OS_LINUX)
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#endif
+
+namespace electron {
+
+namespace {
+
+#if defined(OS_LINUX)
+// Matches what app.getAppMetrics() reports on Linux.
+size_t GetWorkingSetSize(const ProcessMetric& metric) {
+  std::string status;
+  const auto path = base::FilePath("/proc")
+                        .Append(base::NumberToString(metric.process.Pid()))
+                        .Append("status");
+  if (!base::ReadFileToString(path, &status))
+    return 0;
+
+  for (const auto& line : base::SplitStringPiece(
+           status, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (!base::StartsWith(line, "VmRSS:"))
+      continue;
+    auto fields = base::SplitStringPiece(line.substr(6), " \t",
+                                         base::TRIM_WHITESPACE,
+                                         base::SPLIT_WANT_NONEMPTY);
+    size_t value;
+    if (!fields.empty() && base::StringToSizeT(fields[0], &value))
+      return value;
+  }
+  return 0;
+}
+#else
+size_t GetWorkingSetSize(const ProcessMetric& metric) {
+  return metric.GetMemoryInfo().working_set_size >> 10;
+}
+#endif
+
+}  // namespace
+
+ProcessMetricsSampler::History::History() = default;
+ProcessMetricsSampler::History::History(History&&) = default;
+ProcessMetricsSampler::History::~History() = default;
+
+ProcessMetricsSampler::ProcessEntry::ProcessEntry(
+    std::unique_ptr<ProcessMetric> metric)
+    : metric(std::move(metric)) {}
+ProcessMetricsSampler::ProcessEntry::ProcessEntry(ProcessEntry&&) = default;
+ProcessMetricsSampler::ProcessEntry::~ProcessEntry() = default;
+
+// static
+scoped_refptr<base::SequencedTaskRunner>
+ProcessMetricsSampler::CreateTaskRunner() {
+  // BEST_EFFORT tasks may be delayed indefinitely, which would leave gaps in
+  // the history and hold back threshold events.
+  return base::ThreadPool::CreateSequencedTaskRunner(
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+}
+
+ProcessMetricsSampler::ProcessMetricsSampler(const Options& options,
+                                             ThresholdCallback callback)
+    : options_(options),
+      processor_count_(base::SysInfo::NumberOfProcessors()),
+      callback_(std::move(callback)) {
+  DCHECK_GT(options_.history_size, 0u);
+  // Created on the UI thread, used on the sampler's sequence.
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+ProcessMetricsSampler::~ProcessMetricsSampler() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+void ProcessMetricsSampler::Start() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  timer_.Start(FROM_HERE, options_.interval,
+               base::BindRepeating(&ProcessMetricsSampler::TakeSamples,
+                                   base::Unretained(this)));
+}
+
+void ProcessMetricsSampler::AddProcess(int id,
+                                       std::unique_ptr<ProcessMetric> metric) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  processes_.erase(id);
+  auto it = processes_.emplace(id, ProcessEntry(std::move(metric))).first;
+  it->second.samples.reserve(options_.history_size);
+  // The first CPU usage reading only establishes the baseline.
+  it->second.metric->metrics->GetPlatformIndependentCPUUsage();
+}
+
+void ProcessMetricsSampler::RemoveProcess(int id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  processes_.erase(id);
+}
+
+std::vector<ProcessMetricsSampler::History> ProcessMetricsSampler::GetHistory(
+    size_t max_samples) const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  std::vector<History> result;
+  result.reserve(processes_.size());
+
+  for (const auto& it : processes_) {
+    const ProcessEntry& entry = it.second;
+    History history;
+    history.type = entry.metric->type;
+    history.pid = entry.metric->process.Pid();
+    history.creation_time = entry.metric->process.CreationTime();
+    history.service_name = entry.metric->service_name;
+    history.name = entry.metric->name;
+
+    // Until the ring buffer is full the oldest sample is at index 0,
+    // afterwards it is the one about to be overwritten.
+    const size_t size = entry.samples.size();
+    const size_t count = max_samples ? std::min(max_samples, size) : size;
+    const size_t oldest = size < options_.history_size ? 0 : entry.next;
+    history.samples.reserve(count);
+    for (size_t i = size - count; i < size; ++i)
+      history.samples.push_back(entry.samples[(oldest + i) % size]);
+
+    result.push_back(std::move(history));
+  }
+
+  return result;
+}
+
+void ProcessMetricsSampler::TakeSamples() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  const base::Time now = base::Time::Now();
+
+  for (auto& it : processes_) {
+    ProcessEntry& entry = it.second;
+    Sample sample;
+    sample.time = now;
+    sample.percent_cpu_usage =
+        entry.metric->metrics->GetPlatformIndependentCPUUsage() /
+        processor_count_;
+#if !defined(OS_WIN)
+    sample.idle_wakeups_per_second =
+        entry.metric->metrics->GetIdleWakeupsPerSecond();
+#endif
+    sample.working_set_size = GetWorkingSetSize(*entry.metric);
+
+    if (entry.samples.size() < options_.history_size)
+      entry.samples.push_back(sample);
+    else
+      entry.samples[entry.next] = sample;
+    entry.next = (entry.next + 1) % options_.history_size;
+
+    CheckThresholds(&entry, sample);
+  }
+}
+
+void ProcessMetricsSampler::CheckThresholds(ProcessEntry* entry,
+                                            const Sample& sample) {
+  // Only report when a process crosses a threshold, not on every sample it
+  // stays above it.
+  auto check = [&](const char* metric, double value, double threshold,
+                   bool* above) {
+    if (threshold <= 0)
+      return;
+    const bool was_above = *above;
+    *above = value > threshold;
+    if (*above && !was_above) {
+      ThresholdEvent event;
+      event.type = entry->metric->type;
+      event.pid = entry->metric->process.Pid();
+      event.name = entry->metric->name;
+      event.metric = metric;
+      event.value = value;
+      event.threshold = threshold;
+      callback_.Run(std::move(event));
+    }
+  };
+
+  check("cpu", sample.percent_cpu_usage, options_.cpu_threshold,
+        &entry->above_cpu_threshold);
+  check("memory", sample.working_set_size, options_.memory_threshold,
+        &entry->above_memory_threshold);
+}
+
+}  // namespace electron
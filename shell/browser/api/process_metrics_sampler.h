@@ -0,0 +1,116 @@
+// Copyright (c) 2021 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+#define SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/sequence_checker.h"
+#include "base/sequenced_task_runner.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "shell/browser/api/process_metric.h"
+
+namespace electron {
+
+// Periodically samples the CPU and memory usage of the app's processes on a
+// background sequence, keeping a fixed number of samples per process.
+//
+// Apart from construction, every method has to be called on the sampler's
+// own sequence, see CreateTaskRunner().
+class ProcessMetricsSampler {
+ public:
+  struct Options {
+    base::TimeDelta interval = base::TimeDelta::FromSeconds(1);
+    size_t history_size = 60;
+    // Thresholds are disabled when zero.
+    double cpu_threshold = 0;
+    size_t memory_threshold = 0;  // in KB
+  };
+
+  struct Sample {
+    base::Time time;
+    double percent_cpu_usage = 0;
+    int idle_wakeups_per_second = 0;
+    size_t working_set_size = 0;  // in KB
+  };
+
+  struct History {
+    History();
+    History(History&&);
+    ~History();
+
+    int type = 0;
+    base::ProcessId pid = base::kNullProcessId;
+    base::Time creation_time;
+    std::string service_name;
+    std::string name;
+    std::vector<Sample> samples;  // oldest first
+  };
+
+  struct ThresholdEvent {
+    int type = 0;
+    base::ProcessId pid = base::kNullProcessId;
+    std::string name;
+    std::string metric;  // "cpu" or "memory"
+    double value = 0;
+    double threshold = 0;
+  };
+
+  // Called on the sampler's sequence whenever a process starts exceeding one
+  // of the thresholds.
+  using ThresholdCallback = base::RepeatingCallback<void(ThresholdEvent)>;
+
+  static scoped_refptr<base::SequencedTaskRunner> CreateTaskRunner();
+
+  ProcessMetricsSampler(const Options& options, ThresholdCallback callback);
+  ~ProcessMetricsSampler();
+
+  void Start();
+
+  // |id| is the content child process id used by App to key the process.
+  void AddProcess(int id, std::unique_ptr<ProcessMetric> metric);
+  void RemoveProcess(int id);
+
+  // Returns up to |max_samples| of the most recent samples of each process,
+  // or all of them when |max_samples| is zero.
+  std::vector<History> GetHistory(size_t max_samples) const;
+
+ private:
+  struct ProcessEntry {
+    explicit ProcessEntry(std::unique_ptr<ProcessMetric> metric);
+    ProcessEntry(ProcessEntry&&);
+    ~ProcessEntry();
+
+    std::unique_ptr<ProcessMetric> metric;
+    // Ring buffer of samples, |next| is where the next sample goes.
+    std::vector<Sample> samples;
+    size_t next = 0;
+    bool above_cpu_threshold = false;
+    bool above_memory_threshold = false;
+  };
+
+  void TakeSamples();
+  void CheckThresholds(ProcessEntry* entry, const Sample& sample);
+
+  const Options options_;
+  const int processor_count_;
+  ThresholdCallback callback_;
+  std::map<int, ProcessEntry> processes_;
+  base::RepeatingTimer timer_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  DISALLOW_COPY_AND_ASSIGN(ProcessMetricsSampler);
+};
+
+}  // namespace electron
+
+#endif  // SHELL_BROWSER_API_PROCESS_METRICS_SAMPLER_H_
@@ -11,6 +11,7 @@
 #include <memory>
 #include <utility>
 
+#include "base/auto_reset.h"
 #include "base/base_switches.h"
 #include "base/command_line.h"
 #include "base/debug/crash_logging.h"
@@ -372,6 +373,12 @@ ElectronBrowserClient* ElectronBrowserClient::Get() {
   return g_browser_client;
 }
 
+void ElectronBrowserClient::WarmUpSpareRendererProcess(
+    content::BrowserContext* browser_context) {
+  base::AutoReset<bool> launching(&launching_spare_renderer_, true);
+  content::RenderProcessHost::WarmupSpareRenderProcessHost(browser_context);
+}
+
 // static
 void ElectronBrowserClient::SetApplicationLocale(const std::string& locale) {
   if (!BrowserThread::IsThreadInitialized(BrowserThread::IO) ||
@@ -573,6 +580,13 @@ void ElectronBrowserClient::RenderProcessWillLaunch(
     prefs.web_security = web_preferences->IsEnabled(options::kWebSecurity,
                                                     true /* default value */);
     prefs.browser_context = host->GetBrowserContext();
+  } else if (launching_spare_renderer_) {
+    // The spare renderer is only handed to WebContents that would have been
+    // launched with these preferences, see
+    // WebContentsPreferences::CanUseSpareRenderer.
+    prefs.sandbox = true;
+    prefs.native_window_open = true;
+    prefs.browser_context = host->GetBrowserContext();
   }
 
   AddProcessPreferences(host->GetID(), prefs);
@@ -825,6 +839,8 @@ void ElectronBrowserClient::AppendExtraCommandLineSwitches(
       if (web_preferences)
         web_preferences->AppendCommandLineSwitches(
             command_line, IsRendererSubFrame(process_id));
+    } else if (launching_spare_renderer_) {
+      command_line->AppendSwitch(switches::kEnableSandbox);
     }
   }
 }
@@ -1016,6 +1032,12 @@ bool ElectronBrowserClient::ShouldUseProcessPerSite(
 #endif
 }
 
+bool ElectronBrowserClient::ShouldUseSpareRenderProcessHost(
+    content::BrowserContext* browser_context,
+    const GURL& site_url) {
+  return spare_renderer_allowed_;
+}
+
 bool ElectronBrowserClient::ArePersistentMediaDeviceIDsAllowed(
     content::BrowserContext* browser_context,
     const GURL& scope,
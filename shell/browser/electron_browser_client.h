@@ -55,6 +55,15 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
   // Don't force renderer process to restart for once.
   static void SuppressRendererProcessRestartForOnce();
 
+  // Launches a sandboxed spare renderer for |browser_context| that the next
+  // compatible WebContents can take over instead of starting its own process.
+  void WarmUpSpareRendererProcess(content::BrowserContext* browser_context);
+
+  // Whether the process allocation in progress may use the spare renderer.
+  void set_spare_renderer_allowed(bool allowed) {
+    spare_renderer_allowed_ = allowed;
+  }
+
   NotificationPresenter* GetNotificationPresenter();
 
   void WebNotificationAllowed(int render_process_id,
@@ -271,6 +280,8 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
                       const GURL& site_url) override;
   bool ShouldUseProcessPerSite(content::BrowserContext* browser_context,
                                const GURL& effective_url) override;
+  bool ShouldUseSpareRenderProcessHost(content::BrowserContext* browser_context,
+                                       const GURL& site_url) override;
   bool ArePersistentMediaDeviceIDsAllowed(
       content::BrowserContext* browser_context,
       const GURL& scope,
@@ -339,6 +350,13 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
 
   bool disable_process_restart_tricks_ = true;
 
+  // Set while the spare renderer is being launched.
+  bool launching_spare_renderer_ = false;
+
+  // Set while a WebContents whose preferences match the spare renderer is
+  // allocating its first process.
+  bool spare_renderer_allowed_ = false;
+
   // Simple shared ID generator, used by ProxyingURLLoaderFactory and
   // ProxyingWebSocket classes.
   uint64_t next_id_ = 0;
@@ -4,11 +4,15 @@
 
 #include "shell/browser/electron_browser_context.h"
 
+#include <map>
 #include <memory>
-
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/barrier_closure.h"
+#include "base/bind.h"
+#include "base/callback.h"
 #include "base/command_line.h"
 #include "base/files/file_path.h"
 #include "base/no_destructor.h"
@@ -90,6 +94,81 @@ std::string MakePartitionName(const std::string& input) {
   return net::EscapePath(base::ToLowerASCII(input));
 }
 
+base::FilePath GetBrowserContextPath(const std::string& partition,
+                                     bool in_memory) {
+  base::FilePath path;
+  if (!base::PathService::Get(DIR_USER_DATA, &path)) {
+    base::PathService::Get(DIR_APP_DATA, &path);
+    path = path.Append(base::FilePath::FromUTF8Unsafe(GetApplicationName()));
+    base::PathService::Override(DIR_USER_DATA, path);
+    base::PathService::Override(chrome::DIR_USER_DATA, path);
+    base::PathService::Override(
+        chrome::DIR_APP_DICTIONARIES,
+        path.Append(base::FilePath::FromUTF8Unsafe("Dictionaries")));
+  }
+
+  if (!in_memory && !partition.empty())
+    path = path.Append(FILE_PATH_LITERAL("Partitions"))
+               .Append(base::FilePath::FromUTF8Unsafe(
+                   MakePartitionName(partition)));
+  return path;
+}
+
+base::FilePath GetPrefsPath(const base::FilePath& browser_context_path) {
+  return browser_context_path.Append(FILE_PATH_LITERAL("Preferences"));
+}
+
+// Reads a JsonPrefStore on its file task runner and passes it to |callback|
+// once it is initialized. Each store has its own task runner, so stores of
+// different partitions are read in parallel.
+class PrefStoreLoader : public PrefStore::Observer {
+ public:
+  using LoadedCallback =
+      base::OnceCallback<void(scoped_refptr<JsonPrefStore> pref_store)>;
+
+  static void Load(const base::FilePath& path, LoadedCallback callback) {
+    // Deletes itself when the store has been read.
+    auto* loader = new PrefStoreLoader(path, std::move(callback));
+    loader->pref_store_->AddObserver(loader);
+    loader->pref_store_->ReadPrefsAsync(nullptr);
+  }
+
+  // PrefStore::Observer:
+  void OnPrefValueChanged(const std::string& key) override {}
+  void OnInitializationCompleted(bool succeeded) override {
+    // Like the synchronous ReadPrefs() path, a store that failed to read
+    // starts out empty. The store is still notifying its observers, so hand
+    // it over from a fresh task.
+    pref_store_->RemoveObserver(this);
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(std::move(callback_), std::move(pref_store_)));
+    delete this;
+  }
+
+ private:
+  PrefStoreLoader(const base::FilePath& path, LoadedCallback callback)
+      : pref_store_(base::MakeRefCounted<JsonPrefStore>(path)),
+        callback_(std::move(callback)) {}
+  ~PrefStoreLoader() override = default;
+
+  scoped_refptr<JsonPrefStore> pref_store_;
+  LoadedCallback callback_;
+
+  DISALLOW_COPY_AND_ASSIGN(PrefStoreLoader);
+};
+
+using PendingBrowserContextCallbacks =
+    std::vector<base::OnceCallback<void(ElectronBrowserContext*)>>;
+
+std::map<ElectronBrowserContext::PartitionKey, PendingBrowserContextCallbacks>&
+GetPendingBrowserContexts() {
+  static base::NoDestructor<std::map<ElectronBrowserContext::PartitionKey,
+                                     PendingBrowserContextCallbacks>>
+      pending;
+  return *pending;
+}
+
 }  // namespace
 
 // static
@@ -100,9 +179,11 @@ ElectronBrowserContext::browser_context_map() {
   return *browser_context_map;
 }
 
-ElectronBrowserContext::ElectronBrowserContext(const std::string& partition,
-                                               bool in_memory,
-                                               base::DictionaryValue options)
+ElectronBrowserContext::ElectronBrowserContext(
+    const std::string& partition,
+    bool in_memory,
+    base::DictionaryValue options,
+    scoped_refptr<JsonPrefStore> pref_store)
     : storage_policy_(new SpecialStoragePolicy),
       protocol_registry_(new ProtocolRegistry),
       in_memory_(in_memory),
@@ -117,25 +198,12 @@ ElectronBrowserContext::ElectronBrowserContext(const std::string& partition,
   base::StringToInt(command_line->GetSwitchValueASCII(switches::kDiskCacheSize),
                     &max_cache_size_);
 
-  if (!base::PathService::Get(DIR_USER_DATA, &path_)) {
-    base::PathService::Get(DIR_APP_DATA, &path_);
-    path_ = path_.Append(base::FilePath::FromUTF8Unsafe(GetApplicationName()));
-    base::PathService::Override(DIR_USER_DATA, path_);
-    base::PathService::Override(chrome::DIR_USER_DATA, path_);
-    base::PathService::Override(
-        chrome::DIR_APP_DICTIONARIES,
-        path_.Append(base::FilePath::FromUTF8Unsafe("Dictionaries")));
-  }
-
-  if (!in_memory && !partition.empty())
-    path_ = path_.Append(FILE_PATH_LITERAL("Partitions"))
-                .Append(base::FilePath::FromUTF8Unsafe(
-                    MakePartitionName(partition)));
+  path_ = GetBrowserContextPath(partition, in_memory);
 
   BrowserContextDependencyManager::GetInstance()->MarkBrowserContextLive(this);
 
   // Initialize Pref Registry.
-  InitPrefs();
+  InitPrefs(std::move(pref_store));
 
   cookie_change_notifier_ = std::make_unique<CookieChangeNotifier>(this);
 
@@ -164,13 +232,15 @@ ElectronBrowserContext::~ElectronBrowserContext() {
                             std::move(resource_context_));
 }
 
-void ElectronBrowserContext::InitPrefs() {
-  auto prefs_path = GetPath().Append(FILE_PATH_LITERAL("Preferences"));
-  base::ThreadRestrictions::ScopedAllowIO allow_io;
+void ElectronBrowserContext::InitPrefs(
+    scoped_refptr<JsonPrefStore> pref_store) {
   PrefServiceFactory prefs_factory;
-  scoped_refptr<JsonPrefStore> pref_store =
-      base::MakeRefCounted<JsonPrefStore>(prefs_path);
-  pref_store->ReadPrefs();  // Synchronous.
+  if (!pref_store) {
+    base::ThreadRestrictions::ScopedAllowIO allow_io;
+    pref_store = base::MakeRefCounted<JsonPrefStore>(GetPrefsPath(GetPath()));
+    pref_store->ReadPrefs();  // Synchronous.
+  }
+  DCHECK(pref_store->IsInitializationComplete());
   prefs_factory.set_user_prefs(pref_store);
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -435,4 +505,55 @@ ElectronBrowserContext* ElectronBrowserContext::From(
   return new_context;
 }
 
+// static
+void ElectronBrowserContext::FromAsync(
+    const std::string& partition,
+    bool in_memory,
+    base::DictionaryValue options,
+    base::OnceCallback<void(ElectronBrowserContext*)> callback) {
+  PartitionKey key(partition, in_memory);
+  // Nothing is inserted into the map until the context exists, since code
+  // iterating over it, e.g. at shutdown, expects every entry to be set.
+  auto it = browser_context_map().find(key);
+  if (it != browser_context_map().end()) {
+    std::move(callback).Run(it->second.get());
+    return;
+  }
+
+  // Requests for a partition that is already being loaded share its store.
+  auto& pending = GetPendingBrowserContexts()[key];
+  pending.push_back(std::move(callback));
+  if (pending.size() > 1)
+    return;
+
+  PrefStoreLoader::Load(
+      GetPrefsPath(GetBrowserContextPath(partition, in_memory)),
+      base::BindOnce(&ElectronBrowserContext::OnPrefStoreLoaded, key,
+                     std::move(options)));
+}
+
+// static
+void ElectronBrowserContext::OnPrefStoreLoaded(
+    const PartitionKey& key,
+    base::DictionaryValue options,
+    scoped_refptr<JsonPrefStore> pref_store) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  auto it = GetPendingBrowserContexts().find(key);
+  DCHECK(it != GetPendingBrowserContexts().end());
+  PendingBrowserContextCallbacks callbacks = std::move(it->second);
+  GetPendingBrowserContexts().erase(it);
+
+  // The partition may have been created synchronously in the meantime, in
+  // which case the store that was just read is dropped.
+  auto& browser_context = browser_context_map()[key];
+  if (!browser_context) {
+    browser_context.reset(
+        new ElectronBrowserContext(key.partition, key.in_memory,
+                                   std::move(options), std::move(pref_store)));
+  }
+
+  for (auto& callback : callbacks)
+    std::move(callback).Run(browser_context.get());
+}
+
 }  // namespace electron
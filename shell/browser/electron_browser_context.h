@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/callback_forward.h"
 #include "base/memory/weak_ptr.h"
 #include "chrome/browser/predictors/preconnect_manager.h"
 #include "content/public/browser/browser_context.h"
@@ -19,6 +20,7 @@
 #include "services/network/public/mojom/url_loader_factory.mojom.h"
 #include "shell/browser/media/media_device_id_salt.h"
 
+class JsonPrefStore;
 class PrefRegistrySimple;
 class PrefService;
 class ValueMapPrefStore;
@@ -79,6 +81,15 @@ class ElectronBrowserContext : public content::BrowserContext {
       bool in_memory,
       base::DictionaryValue options = base::DictionaryValue());
 
+  // Like From(), but the preferences of a new BrowserContext are read on the
+  // thread pool before it is created, so that no disk I/O happens on the UI
+  // thread. |callback| is run on the UI thread.
+  static void FromAsync(
+      const std::string& partition,
+      bool in_memory,
+      base::DictionaryValue options,
+      base::OnceCallback<void(ElectronBrowserContext*)> callback);
+
   static BrowserContextMap& browser_context_map();
 
   void SetUserAgent(const std::string& user_agent);
@@ -145,12 +156,18 @@ class ElectronBrowserContext : public content::BrowserContext {
   ~ElectronBrowserContext() override;
 
  private:
+  // |pref_store| is read synchronously when it is not already loaded.
   ElectronBrowserContext(const std::string& partition,
                          bool in_memory,
-                         base::DictionaryValue options);
+                         base::DictionaryValue options,
+                         scoped_refptr<JsonPrefStore> pref_store = nullptr);
+
+  static void OnPrefStoreLoaded(const PartitionKey& key,
+                                base::DictionaryValue options,
+                                scoped_refptr<JsonPrefStore> pref_store);
 
   // Initialize pref registry.
-  void InitPrefs();
+  void InitPrefs(scoped_refptr<JsonPrefStore> pref_store);
 
   ValueMapPrefStore* in_memory_pref_store_ = nullptr;
 
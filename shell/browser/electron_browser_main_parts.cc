@@ -48,6 +48,7 @@
 #include "shell/common/gin_helper/trackable_object.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/node_util.h"
 #include "ui/base/idle/idle.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "ui/base/ui_base_switches.h"
@@ -256,6 +257,14 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
 
   v8::HandleScope scope(js_env_->isolate());
 
+  // Keep the code caches of the internal bundles next to the user data.
+  base::FilePath user_data_dir;
+  if (base::PathService::Get(DIR_USER_DATA, &user_data_dir)) {
+    util::SetCodeCacheDirectory(
+        user_data_dir.Append(FILE_PATH_LITERAL("Code Cache"))
+            .AppendASCII("js2c"));
+  }
+
   node_bindings_->Initialize();
   // Create the global environment.
   node::Environment* env = node_bindings_->CreateEnvironment(
@@ -5,6 +5,7 @@
 #include "shell/browser/electron_permission_manager.h"
 
 #include <memory>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -40,6 +41,9 @@ bool WebContentsDestroyed(int process_id) {
   return web_contents->IsBeingDestroyed();
 }
 
+// Bounds the number of cached permission check verdicts.
+constexpr size_t kMaxCheckCacheEntries = 256;
+
 void PermissionRequestResponseCallbackWrapper(
     ElectronPermissionManager::StatusCallback callback,
     const std::vector<blink::mojom::PermissionStatus>& vector) {
@@ -97,6 +101,20 @@ class ElectronPermissionManager::PendingRequest {
   size_t remaining_results_;
 };
 
+ElectronPermissionManager::CheckCacheKey::CheckCacheKey() = default;
+ElectronPermissionManager::CheckCacheKey::CheckCacheKey(const CheckCacheKey&) =
+    default;
+ElectronPermissionManager::CheckCacheKey::~CheckCacheKey() = default;
+
+bool ElectronPermissionManager::CheckCacheKey::operator<(
+    const CheckCacheKey& other) const {
+  return std::tie(web_contents_id, permission, media_type, requesting_origin,
+                  embedding_origin, frame_type) <
+         std::tie(other.web_contents_id, other.permission, other.media_type,
+                  other.requesting_origin, other.embedding_origin,
+                  other.frame_type);
+}
+
 ElectronPermissionManager::ElectronPermissionManager() = default;
 
 ElectronPermissionManager::~ElectronPermissionManager() = default;
@@ -118,6 +136,11 @@ void ElectronPermissionManager::SetPermissionRequestHandler(
 void ElectronPermissionManager::SetPermissionCheckHandler(
     const CheckHandler& handler) {
   check_handler_ = handler;
+  ClearPermissionCheckCache();
+}
+
+void ElectronPermissionManager::ClearPermissionCheckCache() {
+  check_cache_.clear();
 }
 
 void ElectronPermissionManager::RequestPermission(
@@ -258,10 +281,45 @@ bool ElectronPermissionManager::CheckPermissionWithDetails(
   if (check_handler_.is_null()) {
     return true;
   }
+
   auto* web_contents =
       render_frame_host
           ? content::WebContents::FromRenderFrameHost(render_frame_host)
           : nullptr;
+
+  CheckCacheKey key;
+  if (web_contents) {
+    auto* api_web_contents = api::WebContents::From(web_contents);
+    if (api_web_contents)
+      key.web_contents_id = api_web_contents->ID();
+  }
+  key.permission = permission;
+  key.requesting_origin = requesting_origin.GetOrigin();
+  const std::string* embedding_origin =
+      details ? details->FindStringKey("embeddingOrigin") : nullptr;
+  if (embedding_origin) {
+    key.embedding_origin = GURL(*embedding_origin).GetOrigin();
+  } else if (render_frame_host) {
+    key.embedding_origin =
+        render_frame_host->GetMainFrame()->GetLastCommittedOrigin().GetURL();
+  }
+  const std::string* media_type =
+      details ? details->FindStringKey("mediaType") : nullptr;
+  if (media_type)
+    key.media_type = *media_type;
+  if (render_frame_host) {
+    key.frame_type = render_frame_host->GetParent() == nullptr
+                         ? CheckFrameType::kMainFrame
+                         : CheckFrameType::kSubFrame;
+  }
+
+  auto cached = check_cache_.find(key);
+  if (cached != check_cache_.end()) {
+    if (base::TimeTicks::Now() < cached->second.expiry)
+      return cached->second.granted;
+    check_cache_.erase(cached);
+  }
+
   auto mutable_details =
       details == nullptr ? base::DictionaryValue() : details->Clone();
   if (render_frame_host) {
@@ -281,8 +339,24 @@ bool ElectronPermissionManager::CheckPermissionWithDetails(
     default:
       break;
   }
-  return check_handler_.Run(web_contents, permission, requesting_origin,
-                            mutable_details);
+  CheckResult result = check_handler_.Run(web_contents, permission,
+                                          requesting_origin, mutable_details);
+  if (!result.cache_ttl.is_zero() && !result.cache_ttl.is_negative()) {
+    if (check_cache_.size() >= kMaxCheckCacheEntries) {
+      const base::TimeTicks now = base::TimeTicks::Now();
+      for (auto it = check_cache_.begin(); it != check_cache_.end();) {
+        if (it->second.expiry <= now)
+          it = check_cache_.erase(it);
+        else
+          ++it;
+      }
+      if (check_cache_.size() >= kMaxCheckCacheEntries)
+        check_cache_.clear();
+    }
+    check_cache_[key] = {result.granted,
+                         base::TimeTicks::Now() + result.cache_ttl};
+  }
+  return result.granted;
 }
 
 bool ElectronPermissionManager::CheckDevicePermission(
@@ -7,13 +7,16 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "base/callback.h"
 #include "base/containers/id_map.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/permission_controller_delegate.h"
 #include "gin/dictionary.h"
+#include "url/gurl.h"
 
 namespace content {
 class WebContents;
@@ -34,15 +37,24 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
                                              content::PermissionType,
                                              StatusCallback,
                                              const base::Value&)>;
-  using CheckHandler = base::Callback<bool(content::WebContents*,
-                                           content::PermissionType,
-                                           const GURL& requesting_origin,
-                                           const base::Value&)>;
+  // Verdict of the JS permission check handler. A non-zero |cache_ttl| lets
+  // the verdict answer identical checks natively until it expires.
+  struct CheckResult {
+    bool granted = false;
+    base::TimeDelta cache_ttl;
+  };
+  using CheckHandler = base::Callback<CheckResult(content::WebContents*,
+                                                  content::PermissionType,
+                                                  const GURL& requesting_origin,
+                                                  const base::Value&)>;
 
   // Handler to dispatch permission requests in JS.
   void SetPermissionRequestHandler(const RequestHandler& handler);
   void SetPermissionCheckHandler(const CheckHandler& handler);
 
+  // Drops every cached permission check verdict.
+  void ClearPermissionCheckCache();
+
   // content::PermissionControllerDelegate:
   void RequestPermission(content::PermissionType permission,
                          content::RenderFrameHost* render_frame_host,
@@ -113,9 +125,38 @@ class ElectronPermissionManager : public content::PermissionControllerDelegate {
   class PendingRequest;
   using PendingRequestsMap = base::IDMap<std::unique_ptr<PendingRequest>>;
 
+  enum class CheckFrameType { kNone, kMainFrame, kSubFrame };
+
+  struct CheckCacheKey {
+    CheckCacheKey();
+    CheckCacheKey(const CheckCacheKey&);
+    ~CheckCacheKey();
+
+    bool operator<(const CheckCacheKey& other) const;
+
+    // The handler is told which WebContents is checking, so its verdicts only
+    // apply to that WebContents. IDs are never reused.
+    int32_t web_contents_id = 0;
+    content::PermissionType permission;
+    // Media checks share one permission type and differ by media type.
+    std::string media_type;
+    GURL requesting_origin;
+    GURL embedding_origin;
+    CheckFrameType frame_type = CheckFrameType::kNone;
+  };
+
+  struct CheckCacheEntry {
+    bool granted;
+    base::TimeTicks expiry;
+  };
+
   RequestHandler request_handler_;
   CheckHandler check_handler_;
 
+  // Verdicts that the check handler marked as cacheable. Mutable because
+  // CheckPermissionWithDetails is const.
+  mutable std::map<CheckCacheKey, CheckCacheEntry> check_cache_;
+
   PendingRequestsMap pending_requests_;
 
   DISALLOW_COPY_AND_ASSIGN(ElectronPermissionManager);
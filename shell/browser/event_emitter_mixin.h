@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "gin/object_template_builder.h"
+#include "shell/browser/api/electron_api_event_emitter.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/event_emitter.h"
 
@@ -30,6 +31,8 @@ class EventEmitterMixin {
     v8::Local<v8::Object> wrapper;
     if (!static_cast<T*>(this)->GetWrapper(isolate).ToLocal(&wrapper))
       return false;
+    if (!gin_helper::EventEmitterHasListeners(isolate, wrapper, name))
+      return false;
     v8::Local<v8::Object> event = internal::CreateEvent(isolate, wrapper);
     return EmitWithEvent(isolate, wrapper, name, event,
                          std::forward<Args>(args)...);
@@ -45,6 +48,8 @@ class EventEmitterMixin {
     v8::Local<v8::Object> wrapper;
     if (!static_cast<T*>(this)->GetWrapper(isolate).ToLocal(&wrapper))
       return false;
+    if (!gin_helper::EventEmitterHasListeners(isolate, wrapper, name))
+      return false;
     return EmitWithEvent(isolate, wrapper, name, custom_event,
                          std::forward<Args>(args)...);
   }
@@ -4,6 +4,8 @@
 
 #include "shell/browser/javascript_environment.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -12,7 +14,8 @@
 #include "base/allocator/partition_allocator/partition_alloc.h"
 #include "base/command_line.h"
 #include "base/task/current_thread.h"
-#include "base/task/thread_pool/initialization_util.h"
+#include "base/task/thread_pool.h"
+#include "base/task/thread_pool/thread_pool_instance.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/common/content_switches.h"
@@ -22,6 +25,7 @@
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/node_includes.h"
 #include "tracing/trace_event.h"
+#include "v8/include/libplatform/libplatform.h"
 
 namespace {
 v8::Isolate* g_isolate;
@@ -316,6 +320,209 @@ class TracingControllerImpl : public node::tracing::TracingController {
   DISALLOW_COPY_AND_ASSIGN(TracingControllerImpl);
 };
 
+// Node platform that runs V8's background work (concurrent marking, compile
+// jobs, ...) on Chromium's base::ThreadPool, so the browser process has a
+// single worker pool. Everything tied to an isolate or its uv loop stays with
+// node's own platform, whose worker pool only serves as a fallback until the
+// ThreadPool is running.
+class ThreadPoolPlatform : public node::MultiIsolatePlatform {
+ public:
+  explicit ThreadPoolPlatform(node::MultiIsolatePlatform* node_platform)
+      : node_platform_(node_platform) {
+    uv_mutex_init(&pending_tasks_mutex_);
+    uv_cond_init(&pending_tasks_drained_);
+    // Tasks may be posted before the ThreadPool is started, so route V8's
+    // work through it only once it has shown to run tasks.
+    base::ThreadPool::PostTask(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::BindOnce(
+            [](std::atomic<bool>* running) {
+              running->store(true, std::memory_order_release);
+            },
+            &thread_pool_running_));
+  }
+
+  ~ThreadPoolPlatform() override {
+    uv_cond_destroy(&pending_tasks_drained_);
+    uv_mutex_destroy(&pending_tasks_mutex_);
+  }
+
+  // v8::Platform:
+  v8::PageAllocator* GetPageAllocator() override {
+    return node_platform_->GetPageAllocator();
+  }
+  void OnCriticalMemoryPressure() override {
+    node_platform_->OnCriticalMemoryPressure();
+  }
+  int NumberOfWorkerThreads() override {
+    if (!UseThreadPool())
+      return node_platform_->NumberOfWorkerThreads();
+    // Same sizing as gin's V8Platform.
+    const int num_foreground_workers =
+        base::ThreadPoolInstance::Get()
+            ->GetMaxConcurrentNonBlockedTasksWithTraitsDeprecated(
+                {base::TaskPriority::USER_VISIBLE});
+    return std::max(1, num_foreground_workers);
+  }
+  std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(
+      v8::Isolate* isolate) override {
+    return node_platform_->GetForegroundTaskRunner(isolate);
+  }
+  void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    PostWorkerTask(base::TaskPriority::USER_VISIBLE, std::move(task));
+  }
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    PostWorkerTask(base::TaskPriority::USER_BLOCKING, std::move(task));
+  }
+  void CallLowPriorityTaskOnWorkerThread(
+      std::unique_ptr<v8::Task> task) override {
+    PostWorkerTask(base::TaskPriority::BEST_EFFORT, std::move(task));
+  }
+  void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> task,
+                                 double delay_in_seconds) override {
+    if (!UseThreadPool()) {
+      node_platform_->CallDelayedOnWorkerThread(std::move(task),
+                                                delay_in_seconds);
+      return;
+    }
+    base::ThreadPool::PostDelayedTask(
+        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(&v8::Task::Run, std::move(task)),
+        base::TimeDelta::FromSecondsD(delay_in_seconds));
+  }
+  bool IdleTasksEnabled(v8::Isolate* isolate) override {
+    return node_platform_->IdleTasksEnabled(isolate);
+  }
+  std::unique_ptr<v8::JobHandle> PostJob(
+      v8::TaskPriority priority,
+      std::unique_ptr<v8::JobTask> job_task) override {
+    return v8::platform::NewDefaultJobHandle(
+        this, priority, std::move(job_task), NumberOfWorkerThreads());
+  }
+  double MonotonicallyIncreasingTime() override {
+    return node_platform_->MonotonicallyIncreasingTime();
+  }
+  double CurrentClockTimeMillis() override {
+    return node_platform_->CurrentClockTimeMillis();
+  }
+  StackTracePrinter GetStackTracePrinter() override {
+    return node_platform_->GetStackTracePrinter();
+  }
+  v8::TracingController* GetTracingController() override {
+    return node_platform_->GetTracingController();
+  }
+
+  // node::MultiIsolatePlatform:
+  bool FlushForegroundTasks(v8::Isolate* isolate) override {
+    return node_platform_->FlushForegroundTasks(isolate);
+  }
+  void DrainTasks(v8::Isolate* isolate) override {
+    // Foreground tasks may post more background work and the other way
+    // around, so repeat until both sides are idle.
+    do {
+      WaitForPendingTasks();
+      node_platform_->DrainTasks(isolate);
+    } while (HasPendingTasks());
+  }
+  void CancelPendingDelayedTasks(v8::Isolate* isolate) override {
+    node_platform_->CancelPendingDelayedTasks(isolate);
+  }
+  void RegisterIsolate(v8::Isolate* isolate, uv_loop_t* loop) override {
+    node_platform_->RegisterIsolate(isolate, loop);
+  }
+  void RegisterIsolate(v8::Isolate* isolate,
+                       node::IsolatePlatformDelegate* delegate) override {
+    node_platform_->RegisterIsolate(isolate, delegate);
+  }
+  void UnregisterIsolate(v8::Isolate* isolate) override {
+    node_platform_->UnregisterIsolate(isolate);
+  }
+  void AddIsolateFinishedCallback(v8::Isolate* isolate,
+                                  void (*callback)(void*),
+                                  void* data) override {
+    node_platform_->AddIsolateFinishedCallback(isolate, callback, data);
+  }
+
+ private:
+  // Keeps DrainTasks() waiting while a posted task has neither run nor been
+  // dropped by the ThreadPool.
+  class PendingTaskToken {
+   public:
+    explicit PendingTaskToken(ThreadPoolPlatform* platform)
+        : platform_(platform) {
+      uv_mutex_lock(&platform_->pending_tasks_mutex_);
+      ++platform_->pending_tasks_;
+      uv_mutex_unlock(&platform_->pending_tasks_mutex_);
+    }
+    ~PendingTaskToken() {
+      uv_mutex_lock(&platform_->pending_tasks_mutex_);
+      if (--platform_->pending_tasks_ == 0)
+        uv_cond_broadcast(&platform_->pending_tasks_drained_);
+      uv_mutex_unlock(&platform_->pending_tasks_mutex_);
+    }
+
+   private:
+    ThreadPoolPlatform* platform_;
+
+    DISALLOW_COPY_AND_ASSIGN(PendingTaskToken);
+  };
+
+  static void RunWorkerTask(std::unique_ptr<PendingTaskToken> token,
+                            std::unique_ptr<v8::Task> task) {
+    task->Run();
+  }
+
+  bool UseThreadPool() const {
+    return thread_pool_running_.load(std::memory_order_acquire);
+  }
+
+  void PostWorkerTask(base::TaskPriority priority,
+                      std::unique_ptr<v8::Task> task) {
+    if (!UseThreadPool()) {
+      switch (priority) {
+        case base::TaskPriority::USER_BLOCKING:
+          node_platform_->CallBlockingTaskOnWorkerThread(std::move(task));
+          break;
+        case base::TaskPriority::BEST_EFFORT:
+          node_platform_->CallLowPriorityTaskOnWorkerThread(std::move(task));
+          break;
+        default:
+          node_platform_->CallOnWorkerThread(std::move(task));
+          break;
+      }
+      return;
+    }
+    base::ThreadPool::PostTask(
+        FROM_HERE, {priority},
+        base::BindOnce(&RunWorkerTask,
+                       std::make_unique<PendingTaskToken>(this),
+                       std::move(task)));
+  }
+
+  bool HasPendingTasks() {
+    uv_mutex_lock(&pending_tasks_mutex_);
+    bool pending = pending_tasks_ > 0;
+    uv_mutex_unlock(&pending_tasks_mutex_);
+    return pending;
+  }
+
+  void WaitForPendingTasks() {
+    uv_mutex_lock(&pending_tasks_mutex_);
+    while (pending_tasks_ > 0)
+      uv_cond_wait(&pending_tasks_drained_, &pending_tasks_mutex_);
+    uv_mutex_unlock(&pending_tasks_mutex_);
+  }
+
+  node::MultiIsolatePlatform* node_platform_;
+  std::atomic<bool> thread_pool_running_{false};
+
+  uv_mutex_t pending_tasks_mutex_;
+  uv_cond_t pending_tasks_drained_;
+  int pending_tasks_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ThreadPoolPlatform);
+};
+
 v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   auto* cmd = base::CommandLine::ForCurrentProcess();
 
@@ -324,14 +531,15 @@ v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   if (!js_flags.empty())
     v8::V8::SetFlagsFromString(js_flags.c_str(), js_flags.size());
 
-  // The V8Platform of gin relies on Chromium's task schedule, which has not
-  // been started at this point, so we have to rely on Node's V8Platform.
+  // The V8Platform of gin relies on Chromium's task schedule, which might not
+  // have been started at this point, so we build on Node's V8Platform and
+  // move background work to the ThreadPool once it runs. Node's own worker
+  // pool is kept to a single thread for the time before that.
   auto* tracing_agent = node::CreateAgent();
   auto* tracing_controller = new TracingControllerImpl();
   node::tracing::TraceEventHelper::SetAgent(tracing_agent);
-  platform_ = node::CreatePlatform(
-      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0),
-      tracing_controller, gin::V8Platform::PageAllocator());
+  platform_ = new ThreadPoolPlatform(node::CreatePlatform(
+      1, tracing_controller, gin::V8Platform::PageAllocator()));
 
   v8::V8::InitializePlatform(platform_);
   gin::IsolateHolder::Initialize(
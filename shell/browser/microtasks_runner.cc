@@ -5,33 +5,77 @@
 
 #include "shell/browser/microtasks_runner.h"
 
+#include "base/trace_event/trace_event.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_helper/microtasks_scope.h"
 #include "shell/common/node_includes.h"
 #include "v8/include/v8.h"
 
 namespace electron {
 
-MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate) : isolate_(isolate) {}
+namespace {
+
+// Set whenever the browser isolate is entered through the V8 API since the
+// last checkpoint. Only touched on the UI thread.
+bool g_js_entered = false;
+
+// How many tasks pass between two reports of the checkpoint counters.
+constexpr uint64_t kCounterReportInterval = 1000;
+
+}  // namespace
+
+MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate) : isolate_(isolate) {
+  isolate_->AddBeforeCallEnteredCallback(&OnBeforeCallEntered);
+}
+
+MicrotasksRunner::~MicrotasksRunner() {
+  isolate_->RemoveBeforeCallEnteredCallback(&OnBeforeCallEntered);
+}
+
+// static
+void MicrotasksRunner::OnBeforeCallEntered(v8::Isolate* isolate) {
+  g_js_entered = true;
+}
 
 void MicrotasksRunner::WillProcessTask(const base::PendingTask& pending_task,
                                        bool was_blocked_or_low_priority) {}
 
 void MicrotasksRunner::DidProcessTask(const base::PendingTask& pending_task) {
-  v8::Isolate::Scope scope(isolate_);
-  // In the browser process we follow Node.js microtask policy of kExplicit
-  // and let the MicrotaskRunner which is a task observer for chromium UI thread
-  // scheduler run the microtask checkpoint. This worked fine because Node.js
-  // also runs microtasks through its task queue, but after
-  // https://github.com/electron/electron/issues/20013 Node.js now performs its
-  // own microtask checkpoint and it may happen is some situations that there is
-  // contention for performing checkpoint between Node.js and chromium, ending
-  // up Node.js dealying its callbacks. To fix this, now we always lets Node.js
-  // handle the checkpoint in the browser process.
-  {
-    v8::HandleScope scope(isolate_);
-    node::CallbackScope microtasks_scope(isolate_, v8::Object::New(isolate_),
-                                         {0, 0});
+  // Both flags have to be cleared, so don't short-circuit.
+  bool checkpoint_requested =
+      gin_helper::MicrotasksScope::TakeBrowserCheckpointRequest();
+  bool needs_checkpoint = g_js_entered | checkpoint_requested;
+  g_js_entered = false;
+
+  if (needs_checkpoint) {
+    ++checkpoints_performed_;
+    v8::Isolate::Scope scope(isolate_);
+    // In the browser process we follow Node.js microtask policy of kExplicit
+    // and let the MicrotaskRunner which is a task observer for chromium UI
+    // thread scheduler run the microtask checkpoint. This worked fine because
+    // Node.js also runs microtasks through its task queue, but after
+    // https://github.com/electron/electron/issues/20013 Node.js now performs
+    // its own microtask checkpoint and it may happen is some situations that
+    // there is contention for performing checkpoint between Node.js and
+    // chromium, ending up Node.js dealying its callbacks. To fix this, now we
+    // always lets Node.js handle the checkpoint in the browser process.
+    {
+      v8::HandleScope scope(isolate_);
+      node::CallbackScope microtasks_scope(isolate_, v8::Object::New(isolate_),
+                                           {0, 0});
+    }
+    // The checkpoint itself runs JS.
+    g_js_entered = false;
+  } else {
+    ++checkpoints_skipped_;
+  }
+
+  if ((checkpoints_performed_ + checkpoints_skipped_) %
+          kCounterReportInterval ==
+      0) {
+    TRACE_COUNTER2("electron", "MicrotasksRunner::Checkpoints", "performed",
+                   checkpoints_performed_, "skipped", checkpoints_skipped_);
   }
 }
 
@@ -5,6 +5,8 @@
 #ifndef SHELL_BROWSER_MICROTASKS_RUNNER_H_
 #define SHELL_BROWSER_MICROTASKS_RUNNER_H_
 
+#include <cstdint>
+
 #include "base/task/task_observer.h"
 
 namespace v8 {
@@ -19,9 +21,13 @@ namespace electron {
 // Node follows the kExplicit MicrotasksPolicy, and we do the same in browser
 // process. Hence, we need to have this task observer to flush the queued
 // microtasks.
+//
+// Most UI thread tasks never touch JS, so the checkpoint is only performed
+// after tasks that entered JS or a gin_helper::MicrotasksScope.
 class MicrotasksRunner : public base::TaskObserver {
  public:
   explicit MicrotasksRunner(v8::Isolate* isolate);
+  ~MicrotasksRunner() override;
 
   // base::TaskObserver
   void WillProcessTask(const base::PendingTask& pending_task,
@@ -29,7 +35,13 @@ class MicrotasksRunner : public base::TaskObserver {
   void DidProcessTask(const base::PendingTask& pending_task) override;
 
  private:
+  static void OnBeforeCallEntered(v8::Isolate* isolate);
+
   v8::Isolate* isolate_;
+
+  // Checkpoint statistics, reported as trace counters.
+  uint64_t checkpoints_performed_ = 0;
+  uint64_t checkpoints_skipped_ = 0;
 };
 
 }  // namespace electron
@@ -8,10 +8,12 @@
 #include <utility>
 
 #include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/memory/platform_shared_memory_region.h"
 #include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/ref_counted.h"
-#include "base/memory/ref_counted_memory.h"
 #include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/printing/print_job_manager.h"
 #include "chrome/browser/printing/printer_query.h"
@@ -28,6 +30,12 @@
 
 #include "shell/common/node_includes.h"
 
+#if defined(OS_WIN)
+#include <windows.h>
+#elif defined(OS_LINUX)
+#include <sys/mman.h>
+#endif
+
 using content::BrowserThread;
 
 namespace electron {
@@ -48,8 +56,89 @@ void StopWorker(int document_cookie) {
   }
 }
 
+#if defined(OS_WIN) || defined(OS_LINUX)
+void UnmapPdfBuffer(char* data, void* hint) {
+#if defined(OS_WIN)
+  ::UnmapViewOfFile(data);
+#else
+  munmap(data, reinterpret_cast<size_t>(hint));
+#endif
+}
+#endif
+
+// Hands the PDF to JS without copying it where possible. The region is
+// read-only, so it is mapped copy-on-write to keep the Buffer writable;
+// platforms without such a mapping fall back to a copy.
+v8::Local<v8::Value> CreatePdfBuffer(v8::Isolate* isolate,
+                                     base::ReadOnlySharedMemoryRegion region) {
+  const size_t size = region.GetSize();
+#if defined(OS_WIN) || defined(OS_LINUX)
+  auto platform_region =
+      base::ReadOnlySharedMemoryRegion::TakeHandleForSerialization(
+          std::move(region));
+#if defined(OS_WIN)
+  void* data = ::MapViewOfFile(platform_region.GetPlatformHandle(),
+                               FILE_MAP_COPY, 0, 0, size);
+#else
+  void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                    platform_region.GetPlatformHandle().fd, 0);
+  if (data == MAP_FAILED)
+    data = nullptr;
+#endif
+  if (data) {
+    return node::Buffer::New(isolate, static_cast<char*>(data), size,
+                             &UnmapPdfBuffer, reinterpret_cast<void*>(size))
+        .ToLocalChecked();
+  }
+  region =
+      base::ReadOnlySharedMemoryRegion::Deserialize(std::move(platform_region));
+#endif
+
+  base::ReadOnlySharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return node::Buffer::New(isolate, 0).ToLocalChecked();
+  return node::Buffer::Copy(isolate, mapping.GetMemoryAs<char>(),
+                            mapping.size())
+      .ToLocalChecked();
+}
+
+bool WritePdfToFile(const base::FilePath& path,
+                    base::ReadOnlySharedMemoryRegion region) {
+  base::ReadOnlySharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return false;
+  return base::WriteFile(path, mapping.GetMemoryAsSpan<uint8_t>());
+}
+
+void OnPdfWritten(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                  const base::FilePath& path,
+                  bool success) {
+  if (!success) {
+    promise.RejectWithErrorMessage("Failed to write PDF to " +
+                                   path.AsUTF8Unsafe());
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+  promise.Resolve(node::Buffer::New(isolate, 0).ToLocalChecked());
+}
+
 }  // namespace
 
+PrintPreviewMessageHandler::PendingRequest::PendingRequest(
+    gin_helper::Promise<v8::Local<v8::Value>> promise,
+    const base::FilePath& output_path)
+    : promise(std::move(promise)), output_path(output_path) {}
+
+PrintPreviewMessageHandler::PendingRequest::PendingRequest(PendingRequest&&) =
+    default;
+
+PrintPreviewMessageHandler::PendingRequest::~PendingRequest() = default;
+
 PrintPreviewMessageHandler::PrintPreviewMessageHandler(
     content::WebContents* web_contents)
     : web_contents_(web_contents) {
@@ -69,9 +158,6 @@ void PrintPreviewMessageHandler::MetafileReadyForPrinting(
     return;
   }
 
-  const base::ReadOnlySharedMemoryRegion& metafile =
-      params->content->metafile_data_region;
-
   if (printing::IsOopifEnabled()) {
     auto* client =
         printing::PrintCompositeClient::FromWebContents(web_contents_);
@@ -88,9 +174,8 @@ void PrintPreviewMessageHandler::MetafileReadyForPrinting(
             printing::mojom::PrintCompositor::Status::kCompositingFailure,
             base::ReadOnlySharedMemoryRegion()));
   } else {
-    ResolvePromise(
-        request_id,
-        base::RefCountedSharedMemoryMapping::CreateFromWholeRegion(metafile));
+    ResolvePromise(request_id,
+                   std::move(params->content->metafile_data_region));
   }
 }
 
@@ -141,9 +226,7 @@ void PrintPreviewMessageHandler::OnCompositeDocumentToPdfDone(
     return;
   }
 
-  ResolvePromise(
-      request_id,
-      base::RefCountedSharedMemoryMapping::CreateFromWholeRegion(region));
+  ResolvePromise(request_id, std::move(region));
 }
 
 void PrintPreviewMessageHandler::OnCompositePdfPageDone(
@@ -209,10 +292,12 @@ void PrintPreviewMessageHandler::PrintPreviewCancelled(int32_t document_cookie,
 
 void PrintPreviewMessageHandler::PrintToPDF(
     base::DictionaryValue options,
+    const base::FilePath& output_path,
     gin_helper::Promise<v8::Local<v8::Value>> promise) {
   int request_id;
   options.GetInteger(printing::kPreviewRequestID, &request_id);
-  promise_map_.emplace(request_id, std::move(promise));
+  request_map_.emplace(request_id,
+                       PendingRequest(std::move(promise), output_path));
 
   auto* focused_frame = web_contents_->GetFocusedFrame();
   auto* rfh = focused_frame && focused_frame->HasSelection()
@@ -229,23 +314,44 @@ void PrintPreviewMessageHandler::PrintToPDF(
   print_render_frame_->PrintPreview(options.Clone());
 }
 
-gin_helper::Promise<v8::Local<v8::Value>>
-PrintPreviewMessageHandler::GetPromise(int request_id) {
-  auto it = promise_map_.find(request_id);
-  DCHECK(it != promise_map_.end());
+PrintPreviewMessageHandler::PendingRequest
+PrintPreviewMessageHandler::TakeRequest(int request_id) {
+  auto it = request_map_.find(request_id);
+  DCHECK(it != request_map_.end());
 
-  gin_helper::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
-  promise_map_.erase(it);
+  PendingRequest request = std::move(it->second);
+  request_map_.erase(it);
 
-  return promise;
+  return request;
 }
 
 void PrintPreviewMessageHandler::ResolvePromise(
     int request_id,
-    scoped_refptr<base::RefCountedMemory> data_bytes) {
+    base::ReadOnlySharedMemoryRegion region) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  gin_helper::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
+  if (!region.IsValid()) {
+    RejectPromise(request_id);
+    return;
+  }
+
+  PendingRequest request = TakeRequest(request_id);
+
+  if (!request.output_path.empty()) {
+    // Write from the thread pool so the PDF never enters the JS heap.
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+         base::TaskShutdownBehavior::BLOCK_SHUTDOWN},
+        base::BindOnce(&WritePdfToFile, request.output_path,
+                       std::move(region)),
+        base::BindOnce(&OnPdfWritten, std::move(request.promise),
+                       request.output_path));
+    return;
+  }
+
+  gin_helper::Promise<v8::Local<v8::Value>> promise =
+      std::move(request.promise);
 
   v8::Isolate* isolate = promise.isolate();
   gin_helper::Locker locker(isolate);
@@ -253,19 +359,14 @@ void PrintPreviewMessageHandler::ResolvePromise(
   v8::Context::Scope context_scope(
       v8::Local<v8::Context>::New(isolate, promise.GetContext()));
 
-  v8::Local<v8::Value> buffer =
-      node::Buffer::Copy(isolate,
-                         reinterpret_cast<const char*>(data_bytes->front()),
-                         data_bytes->size())
-          .ToLocalChecked();
-
-  promise.Resolve(buffer);
+  promise.Resolve(CreatePdfBuffer(isolate, std::move(region)));
 }
 
 void PrintPreviewMessageHandler::RejectPromise(int request_id) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
-  gin_helper::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
+  gin_helper::Promise<v8::Local<v8::Value>> promise =
+      TakeRequest(request_id).promise;
   promise.RejectWithErrorMessage("Failed to generate PDF");
 }
 
@@ -7,7 +7,8 @@
 
 #include <map>
 
-#include "base/memory/ref_counted_memory.h"
+#include "base/files/file_path.h"
+#include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/weak_ptr.h"
 #include "components/printing/common/print.mojom.h"
 #include "components/services/print_compositor/public/mojom/print_compositor.mojom.h"
@@ -30,7 +31,10 @@ class PrintPreviewMessageHandler
  public:
   ~PrintPreviewMessageHandler() override;
 
+  // When |output_path| is not empty the PDF is written to it instead of
+  // being passed to JS, and the promise resolves with an empty Buffer.
   void PrintToPDF(base::DictionaryValue options,
+                  const base::FilePath& output_path,
                   gin_helper::Promise<v8::Local<v8::Value>> promise);
 
  private:
@@ -75,14 +79,23 @@ class PrintPreviewMessageHandler
   void DidStartPreview(printing::mojom::DidStartPreviewParamsPtr params,
                        int32_t request_id) override {}
 
-  gin_helper::Promise<v8::Local<v8::Value>> GetPromise(int request_id);
+  struct PendingRequest {
+    PendingRequest(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                   const base::FilePath& output_path);
+    PendingRequest(PendingRequest&&);
+    ~PendingRequest();
 
-  void ResolvePromise(int request_id,
-                      scoped_refptr<base::RefCountedMemory> data_bytes);
+    gin_helper::Promise<v8::Local<v8::Value>> promise;
+    base::FilePath output_path;
+  };
+
+  PendingRequest TakeRequest(int request_id);
+
+  void ResolvePromise(int request_id, base::ReadOnlySharedMemoryRegion region);
   void RejectPromise(int request_id);
 
-  using PromiseMap = std::map<int, gin_helper::Promise<v8::Local<v8::Value>>>;
-  PromiseMap promise_map_;
+  using RequestMap = std::map<int, PendingRequest>;
+  RequestMap request_map_;
 
   content::WebContents* web_contents_ = nullptr;
 
@@ -16,6 +16,10 @@ ElectronMenuModel::SharingItem::SharingItem(SharingItem&&) = default;
 ElectronMenuModel::SharingItem::~SharingItem() = default;
 #endif
 
+ElectronMenuModel::ItemState::ItemState() = default;
+ElectronMenuModel::ItemState::ItemState(const ItemState&) = default;
+ElectronMenuModel::ItemState::~ItemState() = default;
+
 bool ElectronMenuModel::Delegate::GetAcceleratorForCommandId(
     int command_id,
     ui::Accelerator* accelerator) const {
@@ -27,6 +31,16 @@ ElectronMenuModel::ElectronMenuModel(Delegate* delegate)
 
 ElectronMenuModel::~ElectronMenuModel() = default;
 
+void ElectronMenuModel::SetItemState(int command_id, const ItemState& state) {
+  item_states_[command_id] = state;
+}
+
+const ElectronMenuModel::ItemState* ElectronMenuModel::GetItemState(
+    int command_id) const {
+  const auto iter = item_states_.find(command_id);
+  return iter == std::end(item_states_) ? nullptr : &iter->second;
+}
+
 void ElectronMenuModel::SetToolTip(int index, const std::u16string& toolTip) {
   int command_id = GetCommandIdAt(index);
   toolTips_[command_id] = toolTip;
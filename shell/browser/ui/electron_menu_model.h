@@ -14,6 +14,7 @@
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/optional.h"
+#include "ui/base/accelerators/accelerator.h"
 #include "ui/base/models/simple_menu_model.h"
 #include "url/gurl.h"
 
@@ -34,6 +35,27 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   };
 #endif
 
+  // State of a menu item as last pushed from JS, so that the delegate can
+  // answer queries about it without calling into JS.
+  struct ItemState {
+    ItemState();
+    ItemState(const ItemState&);
+    ~ItemState();
+
+    bool checked = false;
+    // The item has a role that computes its check status when asked.
+    bool dynamic_checked = false;
+    bool enabled = true;
+    bool visible = true;
+    bool works_when_hidden = true;
+    bool register_accelerator = true;
+    // Whether an accelerator was set on the item, and its parsed value.
+    bool has_accelerator = false;
+    base::Optional<ui::Accelerator> accelerator;
+    // The default accelerator of the item's role, if any.
+    base::Optional<ui::Accelerator> default_accelerator;
+  };
+
   class Delegate : public ui::SimpleMenuModel::Delegate {
    public:
     ~Delegate() override {}
@@ -77,6 +99,9 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   void AddObserver(Observer* obs) { observers_.AddObserver(obs); }
   void RemoveObserver(Observer* obs) { observers_.RemoveObserver(obs); }
 
+  void SetItemState(int command_id, const ItemState& state);
+  // Returns nullptr when no state was set for |command_id|.
+  const ItemState* GetItemState(int command_id) const;
   void SetToolTip(int index, const std::u16string& toolTip);
   std::u16string GetToolTipAt(int index);
   void SetRole(int index, const std::u16string& role);
@@ -117,6 +142,7 @@ class ElectronMenuModel : public ui::SimpleMenuModel {
   std::map<int, std::u16string> toolTips_;   // command id -> tooltip
   std::map<int, std::u16string> roles_;      // command id -> role
   std::map<int, std::u16string> sublabels_;  // command id -> sublabel
+  std::map<int, ItemState> item_states_;     // command id -> state
   base::ObserverList<Observer> observers_;
 
   base::WeakPtrFactory<ElectronMenuModel> weak_factory_{this};
@@ -296,6 +296,35 @@ WebContentsPreferences* WebContentsPreferences::From(
   return FromWebContents(web_contents);
 }
 
+// static
+bool WebContentsPreferences::CanUseSpareRenderer(
+    const gin_helper::Dictionary& web_preferences) {
+  bool b = false;
+  if (!web_preferences.Get(options::kSandbox, &b) || !b)
+    return false;
+  if (web_preferences.Get(options::kWebSecurity, &b) && !b)
+    return false;
+
+  static const char* const kIncompatibleFlags[] = {
+      options::kExperimentalFeatures, options::kOffscreen,
+      options::kScrollBounce, options::kNodeIntegrationInWorker,
+      "disablePopups"};
+  for (const char* flag : kIncompatibleFlags) {
+    if (web_preferences.Get(flag, &b) && b)
+      return false;
+  }
+
+  static const char* const kIncompatibleValues[] = {
+      options::kCustomArgs, "commandLineSwitches",
+      options::kEnableBlinkFeatures, options::kDisableBlinkFeatures};
+  for (const char* key : kIncompatibleValues) {
+    v8::Local<v8::Value> value;
+    if (web_preferences.Get(key, &value) && !value->IsNullOrUndefined())
+      return false;
+  }
+  return true;
+}
+
 void WebContentsPreferences::AppendCommandLineSwitches(
     base::CommandLine* command_line,
     bool is_subframe) {
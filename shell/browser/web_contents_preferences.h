@@ -45,6 +45,12 @@ class WebContentsPreferences
   // $.extend(|web_preferences|, |new_web_preferences|).
   void Merge(const base::DictionaryValue& new_web_preferences);
 
+  // Whether a WebContents created with |web_preferences| would launch its
+  // renderer exactly like the spare renderer, i.e. sandboxed and without any
+  // extra switches. Keep in sync with AppendCommandLineSwitches.
+  static bool CanUseSpareRenderer(
+      const gin_helper::Dictionary& web_preferences);
+
   // Append command paramters according to preferences.
   void AppendCommandLineSwitches(base::CommandLine* command_line,
                                  bool is_subframe);
@@ -4,6 +4,7 @@
 
 #include "shell/common/api/electron_api_native_image.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -11,9 +12,14 @@
 
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/numerics/ranges.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/system/sys_info.h"
+#include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
 #include "gin/arguments.h"
 #include "gin/object_template_builder.h"
@@ -27,20 +33,27 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
+#include "shell/common/gin_helper/locker.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/skia_util.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/encode/SkWebpEncoder.h"
 #include "ui/base/layout.h"
 #include "ui/base/webui/web_ui_util.h"
 #include "ui/gfx/codec/jpeg_codec.h"
 #include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_operations.h"
 #include "ui/gfx/image/image_util.h"
+#include "ui/gfx/skia_util.h"
 
 #if defined(OS_WIN)
 #include "base/win/scoped_gdi_object.h"
@@ -105,6 +118,245 @@ base::win::ScopedHICON ReadICOFromPath(int size, const base::FilePath& path) {
 }
 #endif
 
+struct DecodedImageFile {
+  base::FilePath path;
+  std::vector<gfx::ImageSkiaRep> reps;
+};
+
+// Every scale variant is decoded here, so that the image never has to touch
+// the disk on the UI thread when a HiDPI display asks for another scale.
+DecodedImageFile DecodeImageFileOnThreadPool(const base::FilePath& path) {
+  DecodedImageFile result;
+  result.path = NormalizePath(path);
+#if defined(OS_WIN)
+  // ICO files are loaded through LoadImage by the NativeImage itself.
+  if (result.path.MatchesExtension(FILE_PATH_LITERAL(".ico")))
+    return result;
+#endif
+  util::DecodeImageSkiaRepsFromPath(result.path, &result.reps);
+  return result;
+}
+
+void OnImageFileDecoded(gin_helper::Promise<gin::Handle<NativeImage>> promise,
+                        DecodedImageFile file) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+#if defined(OS_WIN)
+  if (file.path.MatchesExtension(FILE_PATH_LITERAL(".ico"))) {
+    promise.Resolve(NativeImage::CreateFromPath(isolate, file.path));
+    return;
+  }
+#endif
+
+  gfx::ImageSkia image_skia;
+  for (const auto& rep : file.reps)
+    image_skia.AddRepresentation(rep);
+  gin::Handle<NativeImage> handle =
+      NativeImage::Create(isolate, gfx::Image(image_skia));
+#if defined(OS_MAC)
+  if (IsTemplateFilename(file.path))
+    handle->SetTemplateImage(true);
+#endif
+  promise.Resolve(handle);
+}
+
+struct DecodedBuffer {
+  SkBitmap bitmap;
+  double scale_factor = 1.;
+};
+
+DecodedBuffer DecodeBufferOnThreadPool(std::vector<unsigned char> data,
+                                       int width,
+                                       int height,
+                                       double scale_factor) {
+  DecodedBuffer result;
+  result.scale_factor = scale_factor;
+  if (!util::DecodeImageFromBuffer(data.data(), data.size(), width, height,
+                                   &result.bitmap))
+    result.bitmap.reset();
+  return result;
+}
+
+void OnBufferDecoded(gin_helper::Promise<gin::Handle<NativeImage>> promise,
+                     DecodedBuffer decoded) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  gfx::ImageSkia image_skia;
+  if (!decoded.bitmap.isNull()) {
+    image_skia.AddRepresentation(
+        gfx::ImageSkiaRep(decoded.bitmap, decoded.scale_factor));
+  }
+  promise.Resolve(NativeImage::Create(isolate, gfx::Image(image_skia)));
+}
+
+// Image operations can be requested thousands of times in a row, so they are
+// spread over a fixed number of sequences instead of flooding the pool.
+scoped_refptr<base::SequencedTaskRunner> GetImageTaskRunner() {
+  static base::NoDestructor<
+      std::vector<scoped_refptr<base::SequencedTaskRunner>>>
+      task_runners([] {
+        const int count =
+            base::ClampToRange(base::SysInfo::NumberOfProcessors() / 2, 1, 4);
+        std::vector<scoped_refptr<base::SequencedTaskRunner>> runners;
+        for (int i = 0; i < count; ++i) {
+          runners.push_back(base::ThreadPool::CreateSequencedTaskRunner(
+              {base::TaskPriority::USER_VISIBLE,
+               base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}));
+        }
+        return runners;
+      }());
+  static std::atomic<size_t> next_runner{0};
+  return (*task_runners)[next_runner++ % task_runners->size()];
+}
+
+// Parses the options shared by resize() and resizeAsync(). Returns false when
+// the resulting image would be empty.
+bool GetResizeParams(const base::DictionaryValue& options,
+                     const gfx::Size& current_size,
+                     gfx::Size* size,
+                     skia::ImageOperations::ResizeMethod* method) {
+  int width = current_size.width();
+  int height = current_size.height();
+  bool width_set = options.GetInteger("width", &width);
+  bool height_set = options.GetInteger("height", &height);
+  size->SetSize(width, height);
+
+  float aspect_ratio = 1.f;
+  if (!current_size.IsEmpty()) {
+    aspect_ratio = static_cast<float>(current_size.width()) /
+                   static_cast<float>(current_size.height());
+  }
+
+  if (width <= 0 && height <= 0) {
+    return false;
+  } else if (width_set && !height_set) {
+    // Scale height to preserve original aspect ratio
+    size->set_height(width);
+    *size = gfx::ScaleToRoundedSize(*size, 1.f, 1.f / aspect_ratio);
+  } else if (height_set && !width_set) {
+    // Scale width to preserve original aspect ratio
+    size->set_width(height);
+    *size = gfx::ScaleToRoundedSize(*size, aspect_ratio, 1.f);
+  }
+
+  *method = skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+  std::string quality;
+  options.GetString("quality", &quality);
+  if (quality == "good")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality == "better")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return true;
+}
+
+enum class EncodeFormat { kPNG, kJPEG, kWebP };
+
+bool EncodeBitmap(const SkBitmap& bitmap,
+                  EncodeFormat format,
+                  int quality,
+                  std::vector<unsigned char>* output) {
+  switch (format) {
+    case EncodeFormat::kPNG:
+      return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, output);
+    case EncodeFormat::kJPEG:
+      return gfx::JPEGCodec::Encode(bitmap, quality, output);
+    case EncodeFormat::kWebP: {
+      SkPixmap pixmap;
+      if (!bitmap.peekPixels(&pixmap))
+        return false;
+      SkWebpEncoder::Options webp_options;
+      webp_options.fQuality = quality;
+      SkDynamicMemoryWStream stream;
+      if (!SkWebpEncoder::Encode(&stream, pixmap, webp_options))
+        return false;
+      output->resize(stream.bytesWritten());
+      stream.copyTo(output->data());
+      return true;
+    }
+  }
+  return false;
+}
+
+// Converts |bitmap| to N32 premultiplied pixels, which is what toBitmap()
+// returns. readPixels() goes through Skia's vectorized swizzle and
+// premultiply routines when the source is in a different format.
+std::vector<unsigned char> ReadBitmapPixels(const SkBitmap& bitmap) {
+  SkImageInfo info =
+      SkImageInfo::MakeN32Premul(bitmap.width(), bitmap.height());
+  std::vector<unsigned char> pixels(info.computeMinByteSize());
+  if (!bitmap.readPixels(info, pixels.data(), info.minRowBytes(), 0, 0))
+    pixels.clear();
+  return pixels;
+}
+
+std::vector<unsigned char> EncodeBitmapOnThreadPool(const SkBitmap& bitmap,
+                                                    EncodeFormat format,
+                                                    int quality) {
+  std::vector<unsigned char> output;
+  if (!bitmap.isNull() && !EncodeBitmap(bitmap, format, quality, &output))
+    output.clear();
+  return output;
+}
+
+SkBitmap ResizeBitmapOnThreadPool(const SkBitmap& bitmap,
+                                  const gfx::Rect& crop,
+                                  skia::ImageOperations::ResizeMethod method,
+                                  const gfx::Size& size) {
+  SkBitmap source = bitmap;
+  if (!crop.IsEmpty() &&
+      !bitmap.extractSubset(&source, gfx::RectToSkIRect(crop)))
+    return SkBitmap();
+  if (size.IsEmpty() || (size.width() == source.width() &&
+                         size.height() == source.height()))
+    return source;
+  return skia::ImageOperations::Resize(source, method, size.width(),
+                                       size.height());
+}
+
+// Hands |data| over to a Buffer without copying it.
+v8::Local<v8::Value> CreateBufferFromVector(v8::Isolate* isolate,
+                                            std::vector<unsigned char> data) {
+  if (data.empty())
+    return node::Buffer::New(isolate, 0).ToLocalChecked();
+  auto* holder = new std::vector<unsigned char>(std::move(data));
+  return node::Buffer::New(
+             isolate, reinterpret_cast<char*>(holder->data()), holder->size(),
+             [](char*, void* hint) {
+               delete static_cast<std::vector<unsigned char>*>(hint);
+             },
+             holder)
+      .ToLocalChecked();
+}
+
+void ResolveWithBuffer(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                       std::vector<unsigned char> data) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(CreateBufferFromVector(isolate, std::move(data)));
+}
+
+void ResolveWithBitmap(gin_helper::Promise<gin::Handle<NativeImage>> promise,
+                       float scale_factor,
+                       SkBitmap bitmap) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  gfx::ImageSkia image_skia;
+  if (!bitmap.isNull())
+    image_skia.AddRepresentation(gfx::ImageSkiaRep(bitmap, scale_factor));
+  promise.Resolve(NativeImage::Create(isolate, gfx::Image(image_skia)));
+}
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -340,34 +592,10 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
                                              base::DictionaryValue options) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
-  gfx::Size size = GetSize(scale_factor);
-  int width = size.width();
-  int height = size.height();
-  bool width_set = options.GetInteger("width", &width);
-  bool height_set = options.GetInteger("height", &height);
-  size.SetSize(width, height);
-
-  if (width <= 0 && height <= 0) {
+  gfx::Size size;
+  skia::ImageOperations::ResizeMethod method;
+  if (!GetResizeParams(options, GetSize(scale_factor), &size, &method))
     return CreateEmpty(args->isolate());
-  } else if (width_set && !height_set) {
-    // Scale height to preserve original aspect ratio
-    size.set_height(width);
-    size =
-        gfx::ScaleToRoundedSize(size, 1.f, 1.f / GetAspectRatio(scale_factor));
-  } else if (height_set && !width_set) {
-    // Scale width to preserve original aspect ratio
-    size.set_width(height);
-    size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
-  }
-
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string quality;
-  options.GetString("quality", &quality);
-  if (quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
 
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
       image_.AsImageSkia(), method, size);
@@ -375,6 +603,109 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
       args->isolate(), new NativeImage(args->isolate(), gfx::Image(resized)));
 }
 
+v8::Local<v8::Promise> NativeImage::ResizeAsync(gin::Arguments* args,
+                                                base::DictionaryValue options) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  double scale_factor = 1.0;
+  options.GetDouble("scaleFactor", &scale_factor);
+
+  // Only the representation for |scale_factor| is resized, and the pixel
+  // work happens off the calling thread.
+  const gfx::ImageSkiaRep rep =
+      image_.AsImageSkia().GetRepresentation(scale_factor);
+  gfx::Size current_size(rep.GetWidth(), rep.GetHeight());
+
+  gfx::Rect crop;
+  const base::DictionaryValue* crop_dict = nullptr;
+  if (options.GetDictionary("crop", &crop_dict)) {
+    int x = 0, y = 0, width = 0, height = 0;
+    crop_dict->GetInteger("x", &x);
+    crop_dict->GetInteger("y", &y);
+    crop_dict->GetInteger("width", &width);
+    crop_dict->GetInteger("height", &height);
+    crop = gfx::Rect(x, y, width, height);
+    crop.Intersect(gfx::Rect(current_size));
+    if (crop.IsEmpty()) {
+      promise.Resolve(CreateEmpty(args->isolate()));
+      return handle;
+    }
+    current_size = crop.size();
+  }
+
+  gfx::Size size;
+  skia::ImageOperations::ResizeMethod method;
+  if (rep.is_null() ||
+      !GetResizeParams(options, current_size, &size, &method)) {
+    promise.Resolve(CreateEmpty(args->isolate()));
+    return handle;
+  }
+
+  GetImageTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&ResizeBitmapOnThreadPool, rep.GetBitmap(),
+                     gfx::ScaleToEnclosingRect(crop, rep.scale()), method,
+                     gfx::ScaleToRoundedSize(size, rep.scale())),
+      base::BindOnce(&ResolveWithBitmap, std::move(promise), rep.scale()));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::EncodeAsync(gin::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::string format_name = "png";
+  int quality = 90;
+  float scale_factor = 1.0f;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("format", &format_name);
+    options.Get("quality", &quality);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  EncodeFormat format;
+  if (format_name == "png") {
+    format = EncodeFormat::kPNG;
+  } else if (format_name == "jpeg") {
+    format = EncodeFormat::kJPEG;
+  } else if (format_name == "webp") {
+    format = EncodeFormat::kWebP;
+  } else {
+    promise.RejectWithErrorMessage("Unsupported image format '" +
+                                   format_name + "'");
+    return handle;
+  }
+
+  if (quality < 0 || quality > 100) {
+    promise.RejectWithErrorMessage("quality must be between 0 and 100");
+    return handle;
+  }
+
+  GetImageTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(
+          &EncodeBitmapOnThreadPool,
+          image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap(),
+          format, quality),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> NativeImage::ToBitmapAsync(gin::Arguments* args) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  float scale_factor = GetScaleFactorFromOptions(args);
+
+  GetImageTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(
+          &ReadBitmapPixels,
+          image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap()),
+      base::BindOnce(&ResolveWithBuffer, std::move(promise)));
+  return handle;
+}
+
 gin::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
                                            const gfx::Rect& rect) {
   gfx::ImageSkia cropped =
@@ -558,6 +889,56 @@ gin::Handle<NativeImage> NativeImage::CreateFromBuffer(
   return Create(args->isolate(), gfx::Image(image_skia));
 }
 
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromPathAsync(
+    v8::Isolate* isolate,
+    const base::FilePath& path) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&DecodeImageFileOnThreadPool, path),
+      base::BindOnce(&OnImageFileDecoded, std::move(promise)));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromBufferAsync(
+    v8::Local<v8::Value> buffer,
+    gin::Arguments* args) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!node::Buffer::HasInstance(buffer)) {
+    promise.RejectWithErrorMessage("buffer must be a node Buffer");
+    return handle;
+  }
+
+  int width = 0;
+  int height = 0;
+  double scale_factor = 1.;
+
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("width", &width);
+    options.Get("height", &height);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  // The Buffer may be modified or collected while the decode is in flight.
+  const auto* data =
+      reinterpret_cast<const unsigned char*>(node::Buffer::Data(buffer));
+  std::vector<unsigned char> bytes(data, data + node::Buffer::Length(buffer));
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&DecodeBufferOnThreadPool, std::move(bytes), width,
+                     height, scale_factor),
+      base::BindOnce(&OnBufferDecoded, std::move(promise)));
+  return handle;
+}
+
 // static
 gin::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
                                                         const GURL& url) {
@@ -607,6 +988,9 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
+      .SetMethod("encodeAsync", &NativeImage::EncodeAsync)
+      .SetMethod("toBitmapAsync", &NativeImage::ToBitmapAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
@@ -640,6 +1024,10 @@ void Initialize(v8::Local<v8::Object> exports,
   native_image.SetMethod("createFromPath", &NativeImage::CreateFromPath);
   native_image.SetMethod("createFromBitmap", &NativeImage::CreateFromBitmap);
   native_image.SetMethod("createFromBuffer", &NativeImage::CreateFromBuffer);
+  native_image.SetMethod("createFromPathAsync",
+                         &NativeImage::CreateFromPathAsync);
+  native_image.SetMethod("createFromBufferAsync",
+                         &NativeImage::CreateFromBufferAsync);
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
@@ -66,6 +66,13 @@ class NativeImage : public gin::Wrappable<NativeImage> {
       gin::Arguments* args);
   static gin::Handle<NativeImage> CreateFromDataURL(v8::Isolate* isolate,
                                                     const GURL& url);
+  // Same as CreateFromPath and CreateFromBuffer, but reading and decoding
+  // happen on the thread pool.
+  static v8::Local<v8::Promise> CreateFromPathAsync(v8::Isolate* isolate,
+                                                    const base::FilePath& path);
+  static v8::Local<v8::Promise> CreateFromBufferAsync(
+      v8::Local<v8::Value> buffer,
+      gin::Arguments* args);
   static gin::Handle<NativeImage> CreateFromNamedImage(gin::Arguments* args,
                                                        std::string name);
 #if !defined(OS_LINUX)
@@ -112,6 +119,12 @@ class NativeImage : public gin::Wrappable<NativeImage> {
   gin::Handle<NativeImage> Resize(gin::Arguments* args,
                                   base::DictionaryValue options);
   gin::Handle<NativeImage> Crop(v8::Isolate* isolate, const gfx::Rect& rect);
+  // Promise-returning variants that do the pixel work on a bounded set of
+  // thread pool sequences.
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     base::DictionaryValue options);
+  v8::Local<v8::Promise> EncodeAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ToBitmapAsync(gin::Arguments* args);
   std::string ToDataURL(gin::Arguments* args);
   bool IsEmpty();
   gfx::Size GetSize(const base::Optional<float> scale_factor);
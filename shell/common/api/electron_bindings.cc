@@ -325,13 +325,24 @@ v8::Local<v8::Value> ElectronBindings::GetIOCounters(v8::Isolate* isolate) {
 
 // static
 bool ElectronBindings::TakeHeapSnapshot(v8::Isolate* isolate,
-                                        const base::FilePath& file_path) {
+                                        const base::FilePath& file_path,
+                                        gin_helper::Arguments* args) {
+  HeapSnapshotCompression compression = HeapSnapshotCompression::kNone;
+  gin_helper::Dictionary options;
+  v8::Local<v8::Value> value;
+  if (args->GetNext(&options) && options.Get("compression", &value) &&
+      !value->IsUndefined() &&
+      !gin::ConvertFromV8(isolate, value, &compression)) {
+    args->ThrowError("Invalid compression, expected 'none' or 'gzip'");
+    return false;
+  }
+
   base::ThreadRestrictions::ScopedAllowIO allow_io;
 
   base::File file(file_path,
                   base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
 
-  return electron::TakeHeapSnapshot(isolate, &file);
+  return electron::TakeHeapSnapshot(isolate, std::move(file), compression);
 }
 
 }  // namespace electron
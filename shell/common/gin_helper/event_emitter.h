@@ -53,6 +53,10 @@ class EventEmitter : public gin_helper::Wrappable<T> {
   bool EmitCustomEvent(base::StringPiece name,
                        v8::Local<v8::Object> event,
                        Args&&... args) {
+    v8::Local<v8::Object> wrapper = GetWrapper();
+    if (wrapper.IsEmpty() ||
+        !EventEmitterHasListeners(isolate(), wrapper, name))
+      return false;
     return EmitWithEvent(name,
                          internal::CreateEvent(isolate(), GetWrapper(), event),
                          std::forward<Args>(args)...);
@@ -66,6 +70,8 @@ class EventEmitter : public gin_helper::Wrappable<T> {
     v8::Local<v8::Object> wrapper = GetWrapper();
     if (wrapper.IsEmpty())
       return false;
+    if (!EventEmitterHasListeners(isolate(), wrapper, name))
+      return false;
     v8::Local<v8::Object> event = internal::CreateEvent(isolate(), wrapper);
     return EmitWithEvent(name, event, std::forward<Args>(args)...);
   }
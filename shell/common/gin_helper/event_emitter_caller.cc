@@ -4,12 +4,23 @@
 
 #include "shell/common/gin_helper/event_emitter_caller.h"
 
+#include "base/no_destructor.h"
 #include "shell/common/gin_helper/locker.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
 #include "shell/common/node_includes.h"
 
 namespace gin_helper {
 
+namespace {
+
+// EventEmitter.prototype.emit, set once the browser hands over the prototype.
+v8::Global<v8::Value>* GetEventEmitterEmitReference() {
+  static base::NoDestructor<v8::Global<v8::Value>> event_emitter_emit;
+  return event_emitter_emit.get();
+}
+
+}  // namespace
+
 namespace internal {
 
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
@@ -35,4 +46,45 @@ v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
 
 }  // namespace internal
 
+void SetEventEmitterEmit(v8::Isolate* isolate, v8::Local<v8::Value> emit) {
+  GetEventEmitterEmitReference()->Reset(isolate, emit);
+}
+
+bool EventEmitterHasListeners(v8::Isolate* isolate,
+                              v8::Local<v8::Object> emitter,
+                              base::StringPiece name) {
+  // Unhandled 'error' events throw, so they always have to be emitted.
+  if (name == "error")
+    return true;
+
+  v8::Global<v8::Value>* stock_emit = GetEventEmitterEmitReference();
+  if (stock_emit->IsEmpty())
+    return true;
+
+  v8::TryCatch try_catch(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  // An event with listeners is emitted anyway, so only a missing listener
+  // needs the emit() lookup below.
+  v8::Local<v8::Value> events;
+  if (emitter->Get(context, gin::StringToSymbol(isolate, "_events"))
+          .ToLocal(&events) &&
+      events->IsObject()) {
+    v8::Local<v8::Value> listeners;
+    if (!events.As<v8::Object>()
+             ->Get(context, gin::StringToV8(isolate, name))
+             .ToLocal(&listeners) ||
+        !listeners->IsUndefined())
+      return true;
+  } else if (events.IsEmpty()) {
+    return true;
+  }
+
+  // Objects that override emit() may forward events elsewhere.
+  v8::Local<v8::Value> emit;
+  return !emitter->Get(context, gin::StringToSymbol(isolate, "emit"))
+              .ToLocal(&emit) ||
+         !emit->StrictEquals(stock_emit->Get(isolate));
+}
+
 }  // namespace gin_helper
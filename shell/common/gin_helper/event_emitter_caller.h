@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/string_piece.h"
 #include "gin/converter.h"
 #include "gin/wrappable.h"
 
@@ -24,6 +25,18 @@ v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
 
 }  // namespace internal
 
+// Remembers EventEmitter.prototype.emit, so that EventEmitterHasListeners can
+// tell whether an emitter overrides it.
+void SetEventEmitterEmit(v8::Isolate* isolate, v8::Local<v8::Value> emit);
+
+// Returns false only when emitting |name| on |emitter| is known to be a no-op:
+// |emitter| uses the stock EventEmitter.prototype.emit and has no listener for
+// |name|. Lets native code skip creating the Event object and entering JS.
+// The caller is responsible for allocating a HandleScope.
+bool EventEmitterHasListeners(v8::Isolate* isolate,
+                              v8::Local<v8::Object> emitter,
+                              base::StringPiece name);
+
 // obj.emit.apply(obj, name, args...);
 // The caller is responsible of allocating a HandleScope.
 template <typename StringType>
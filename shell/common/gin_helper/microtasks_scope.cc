@@ -4,13 +4,24 @@
 
 #include "shell/common/gin_helper/microtasks_scope.h"
 
+#include <atomic>
+
 #include "shell/common/gin_helper/locker.h"
 
 namespace gin_helper {
 
+namespace {
+
+std::atomic<bool> g_browser_checkpoint_requested{false};
+
+}  // namespace
+
 MicrotasksScope::MicrotasksScope(v8::Isolate* isolate,
                                  bool ignore_browser_checkpoint) {
   if (Locker::IsBrowserProcess()) {
+    // Promises settled inside this scope queue their reactions after the
+    // checkpoint below, the MicrotasksRunner has to flush them.
+    g_browser_checkpoint_requested.store(true, std::memory_order_relaxed);
     if (!ignore_browser_checkpoint)
       v8::MicrotasksScope::PerformCheckpoint(isolate);
   } else {
@@ -21,4 +32,10 @@ MicrotasksScope::MicrotasksScope(v8::Isolate* isolate,
 
 MicrotasksScope::~MicrotasksScope() = default;
 
+// static
+bool MicrotasksScope::TakeBrowserCheckpointRequest() {
+  return g_browser_checkpoint_requested.exchange(false,
+                                                 std::memory_order_relaxed);
+}
+
 }  // namespace gin_helper
@@ -20,6 +20,10 @@ class MicrotasksScope {
                            bool ignore_browser_checkpoint = false);
   ~MicrotasksScope();
 
+  // Returns whether a MicrotasksScope was entered in the browser process since
+  // the last call, meaning microtasks may have been queued from C++.
+  static bool TakeBrowserCheckpointRequest();
+
  private:
   std::unique_ptr<v8::MicrotasksScope> v8_microtasks_scope_;
 
@@ -4,14 +4,178 @@
 
 #include "shell/common/heap_snapshot.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/callback.h"
+#include "base/containers/circular_deque.h"
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
+#include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
+#include "third_party/zlib/zlib.h"
 #include "v8/include/v8-profiler.h"
 
 namespace {
 
+// Upper bound on serialized data waiting to be written. Past it the isolate
+// thread writes the backlog itself, so that a slow disk throttles
+// serialization instead of the whole snapshot piling up in memory.
+constexpr size_t kMaxPendingBytes = 32 * 1024 * 1024;
+
+constexpr size_t kDeflateBufferSize = 64 * 1024;
+
+// Compresses and writes snapshot chunks. With a task runner, the chunks are
+// written on it while V8 is still serializing; without one they are written
+// on the calling thread.
+class HeapSnapshotWriter
+    : public base::RefCountedThreadSafe<HeapSnapshotWriter> {
+ public:
+  HeapSnapshotWriter(base::File file,
+                     electron::HeapSnapshotCompression compression,
+                     scoped_refptr<base::SequencedTaskRunner> task_runner)
+      : task_runner_(std::move(task_runner)),
+        file_(std::move(file)),
+        compression_(compression) {
+    if (compression_ == electron::HeapSnapshotCompression::kGzip) {
+      // 16 + MAX_WBITS selects the gzip wrapper. Snapshots are large and
+      // repetitive, so the fastest level already shrinks them several times.
+      write_failed_ = deflateInit2(&zstream_, Z_BEST_SPEED, Z_DEFLATED,
+                                   16 + MAX_WBITS, 8,
+                                   Z_DEFAULT_STRATEGY) != Z_OK;
+      zstream_initialized_ = !write_failed_;
+      deflate_buffer_.resize(kDeflateBufferSize);
+    }
+  }
+
+  // Queues a chunk for writing. Called on the isolate thread.
+  bool Write(const char* data, int size) {
+    bool drain_now = !task_runner_;
+    bool post_drain = false;
+    {
+      base::AutoLock auto_lock(queue_lock_);
+      if (write_failed_)
+        return false;
+      queue_.emplace_back(data, size);
+      pending_bytes_ += size;
+      if (pending_bytes_ > kMaxPendingBytes) {
+        drain_now = true;
+      } else if (task_runner_ && !drain_scheduled_) {
+        drain_scheduled_ = true;
+        post_drain = true;
+      }
+    }
+
+    if (drain_now)
+      return Drain();
+    if (post_drain) {
+      task_runner_->PostTask(
+          FROM_HERE,
+          base::BindOnce(base::IgnoreResult(&HeapSnapshotWriter::Drain), this));
+    }
+    return true;
+  }
+
+  // Writes what is left and closes the file, on |task_runner_|.
+  void Finish(base::OnceCallback<void(bool)> callback) {
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&HeapSnapshotWriter::FinishNow, this),
+        std::move(callback));
+  }
+
+  // Writes what is left and closes the file, on the calling thread.
+  bool FinishNow() {
+    bool success = Drain();
+    base::AutoLock output_lock(output_lock_);
+    if (success && compression_ == electron::HeapSnapshotCompression::kGzip)
+      success = Deflate(nullptr, 0, Z_FINISH);
+    file_.Close();
+    return success;
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<HeapSnapshotWriter>;
+
+  ~HeapSnapshotWriter() {
+    if (zstream_initialized_)
+      deflateEnd(&zstream_);
+  }
+
+  // Writes the queued chunks in order. Runs on |task_runner_|, or on the
+  // isolate thread when the backlog has grown too large; |output_lock_| keeps
+  // the two from interleaving. Returns false once a write has failed.
+  bool Drain() {
+    base::AutoLock output_lock(output_lock_);
+    for (;;) {
+      std::string chunk;
+      {
+        base::AutoLock auto_lock(queue_lock_);
+        if (queue_.empty() || write_failed_) {
+          drain_scheduled_ = false;
+          return !write_failed_;
+        }
+        chunk = std::move(queue_.front());
+        queue_.pop_front();
+        pending_bytes_ -= chunk.size();
+      }
+
+      bool written =
+          compression_ == electron::HeapSnapshotCompression::kGzip
+              ? Deflate(chunk.data(), chunk.size(), Z_NO_FLUSH)
+              : WriteToFile(chunk.data(), chunk.size());
+      if (!written) {
+        base::AutoLock auto_lock(queue_lock_);
+        write_failed_ = true;
+      }
+    }
+  }
+
+  bool Deflate(const char* data, size_t size, int flush) {
+    zstream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    zstream_.avail_in = size;
+    do {
+      zstream_.next_out = reinterpret_cast<Bytef*>(deflate_buffer_.data());
+      zstream_.avail_out = deflate_buffer_.size();
+      if (deflate(&zstream_, flush) == Z_STREAM_ERROR)
+        return false;
+      size_t have = deflate_buffer_.size() - zstream_.avail_out;
+      if (have > 0 && !WriteToFile(deflate_buffer_.data(), have))
+        return false;
+    } while (zstream_.avail_out == 0);
+    return true;
+  }
+
+  bool WriteToFile(const char* data, size_t size) {
+    return file_.WriteAtCurrentPos(data, size) == static_cast<int>(size);
+  }
+
+  const scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  // Guards the output, which is written by one thread at a time.
+  base::Lock output_lock_;
+  base::File file_;
+  const electron::HeapSnapshotCompression compression_;
+  z_stream zstream_ = {};
+  bool zstream_initialized_ = false;
+  std::vector<char> deflate_buffer_;
+
+  base::Lock queue_lock_;
+  base::circular_deque<std::string> queue_;  // Guarded by |queue_lock_|.
+  size_t pending_bytes_ = 0;                  // Guarded by |queue_lock_|.
+  bool drain_scheduled_ = false;              // Guarded by |queue_lock_|.
+  bool write_failed_ = false;                 // Guarded by |queue_lock_|.
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotWriter);
+};
+
 class HeapSnapshotOutputStream : public v8::OutputStream {
  public:
-  explicit HeapSnapshotOutputStream(base::File* file) : file_(file) {
-    DCHECK(file_);
+  explicit HeapSnapshotOutputStream(HeapSnapshotWriter* writer)
+      : writer_(writer) {
+    DCHECK(writer_);
   }
 
   bool IsComplete() const { return is_complete_; }
@@ -21,36 +185,68 @@ class HeapSnapshotOutputStream : public v8::OutputStream {
   void EndOfStream() override { is_complete_ = true; }
 
   v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
-    auto bytes_written = file_->WriteAtCurrentPos(data, size);
-    return bytes_written == size ? kContinue : kAbort;
+    return writer_->Write(data, size) ? kContinue : kAbort;
   }
 
  private:
-  base::File* file_ = nullptr;
+  HeapSnapshotWriter* writer_ = nullptr;
   bool is_complete_ = false;
 };
 
+// Serializes a snapshot of |isolate| into |writer|, returning whether V8
+// produced the complete snapshot.
+bool SerializeHeapSnapshot(v8::Isolate* isolate, HeapSnapshotWriter* writer) {
+  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot)
+    return false;
+
+  HeapSnapshotOutputStream stream(writer);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+
+  return stream.IsComplete();
+}
+
 }  // namespace
 
 namespace electron {
 
-bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
+void TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotCompression compression,
+                      base::OnceCallback<void(bool)> callback) {
   DCHECK(isolate);
-  DCHECK(file);
 
-  if (!file->IsValid())
-    return false;
+  if (!file.IsValid()) {
+    std::move(callback).Run(false);
+    return;
+  }
 
-  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot();
-  if (!snapshot)
-    return false;
+  auto writer = base::MakeRefCounted<HeapSnapshotWriter>(
+      std::move(file), compression,
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN}));
+  bool complete = SerializeHeapSnapshot(isolate, writer.get());
+  writer->Finish(base::BindOnce(
+      [](bool complete, base::OnceCallback<void(bool)> callback,
+         bool written) { std::move(callback).Run(complete && written); },
+      complete, std::move(callback)));
+}
 
-  HeapSnapshotOutputStream stream(file);
-  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+bool TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotCompression compression) {
+  DCHECK(isolate);
 
-  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+  if (!file.IsValid())
+    return false;
 
-  return stream.IsComplete();
+  auto writer = base::MakeRefCounted<HeapSnapshotWriter>(
+      std::move(file), compression, nullptr);
+  bool complete = SerializeHeapSnapshot(isolate, writer.get());
+  return writer->FinishNow() && complete;
 }
 
 }  // namespace electron
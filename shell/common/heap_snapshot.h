@@ -5,13 +5,59 @@
 #ifndef SHELL_COMMON_HEAP_SNAPSHOT_H_
 #define SHELL_COMMON_HEAP_SNAPSHOT_H_
 
+#include <string>
+
+#include "base/callback_forward.h"
 #include "base/files/file.h"
+#include "gin/converter.h"
 #include "v8/include/v8.h"
 
 namespace electron {
 
-bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file);
+enum class HeapSnapshotCompression {
+  kNone,
+  kGzip,
+};
+
+// V8 can only serialize a snapshot on the isolate's thread, so that part
+// blocks the caller. Compression and writes to |file| run on a background
+// sequence while serialization is still going, and |callback| is run on the
+// calling sequence once everything has been written. When the writes fall
+// too far behind, the calling thread writes the backlog itself, so it has to
+// allow blocking.
+void TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotCompression compression,
+                      base::OnceCallback<void(bool)> callback);
+
+// Same as above, but compresses and writes on the calling thread, which has to
+// allow blocking.
+bool TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotCompression compression);
 
 }  // namespace electron
 
+namespace gin {
+
+template <>
+struct Converter<electron::HeapSnapshotCompression> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::HeapSnapshotCompression* out) {
+    std::string compression;
+    if (!ConvertFromV8(isolate, val, &compression))
+      return false;
+    if (compression == "none")
+      *out = electron::HeapSnapshotCompression::kNone;
+    else if (compression == "gzip")
+      *out = electron::HeapSnapshotCompression::kGzip;
+    else
+      return false;
+    return true;
+  }
+};
+
+}  // namespace gin
+
 #endif  // SHELL_COMMON_HEAP_SNAPSHOT_H_
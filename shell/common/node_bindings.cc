@@ -316,17 +316,20 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
 }
 
 NodeBindings::~NodeBindings() {
-  // Quit the embed thread.
-  embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_running_) {
+    // Quit the embed thread.
+    embed_closed_ = true;
+    uv_sem_post(&embed_sem_);
 
-  WakeupEmbedThread();
+    WakeupEmbedThread();
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
+
+    uv_sem_destroy(&embed_sem_);
+  }
 
   // Clear uv.
-  uv_sem_destroy(&embed_sem_);
   dummy_uv_handle_.reset();
 
   // Clean up worker loop
@@ -554,9 +557,13 @@ void NodeBindings::PrepareMessageLoop() {
   // nothing to do.
   uv_async_init(uv_loop_, dummy_uv_handle_.get(), nullptr);
 
+  if (WatchBackendFd())
+    return;
+
   // Start worker that will interrupt main loop when having uv events.
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
+  embed_thread_running_ = true;
 }
 
 void NodeBindings::RunMessageLoop() {
@@ -605,8 +612,17 @@ void NodeBindings::UvRunOnce() {
   if (r == 0)
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
+  ResumePolling();
+}
+
+bool NodeBindings::WatchBackendFd() {
+  return false;
+}
+
+void NodeBindings::ResumePolling() {
   // Tell the worker thread to continue polling.
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_running_)
+    uv_sem_post(&embed_sem_);
 }
 
 void NodeBindings::WakeupMainThread() {
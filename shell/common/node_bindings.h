@@ -116,6 +116,14 @@ class NodeBindings {
   // Called to poll events in new thread.
   virtual void PollEvents() = 0;
 
+  // Called when the backend fd of |uv_loop_| changes. Returns true if the
+  // platform watches the fd on the current thread's message pump, in which
+  // case no embed thread is started.
+  virtual bool WatchBackendFd();
+
+  // Called after each UvRunOnce to wait for the next libuv event.
+  virtual void ResumePolling();
+
   // Run the libuv loop for once.
   void UvRunOnce();
 
@@ -141,6 +149,9 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether |embed_thread_| has been started.
+  bool embed_thread_running_ = false;
+
   // Loop used when constructed in WORKER mode
   uv_loop_t worker_loop_;
 
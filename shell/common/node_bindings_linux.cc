@@ -6,6 +6,11 @@
 
 #include <sys/epoll.h>
 
+#include "base/bind.h"
+#include "base/notreached.h"
+#include "base/task/current_thread.h"
+#include "base/threading/thread_task_runner_handle.h"
+
 namespace electron {
 
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
@@ -27,10 +32,59 @@ void NodeBindingsLinux::RunMessageLoop() {
   NodeBindings::RunMessageLoop();
 }
 
+bool NodeBindingsLinux::WatchBackendFd() {
+#if defined(USE_OZONE)
+  // Only the browser's UI thread runs a pump that can watch file descriptors,
+  // renderers and workers keep polling on the embed thread.
+  if (browser_env_ != BrowserEnvironment::kBrowser ||
+      !base::CurrentUIThread::IsSet())
+    return false;
+
+  backend_fd_controller_ =
+      std::make_unique<base::MessagePumpForUI::FdWatchController>(FROM_HERE);
+  watching_backend_fd_ = true;
+  ResumePolling();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void NodeBindingsLinux::ResumePolling() {
+  if (!watching_backend_fd_) {
+    NodeBindings::ResumePolling();
+    return;
+  }
+
+#if defined(USE_OZONE)
+  // The watch is not persistent, so the pump does not keep reporting the fd
+  // while the posted UvRunOnce has yet to drain it.
+  base::CurrentUIThread::Get()->WatchFileDescriptor(
+      uv_backend_fd(uv_loop_), false, base::MessagePumpForUI::WATCH_READ,
+      backend_fd_controller_.get(), this);
+#endif
+
+  int timeout = uv_backend_timeout(uv_loop_);
+  if (timeout < 0) {
+    uv_timer_.Stop();
+  } else {
+    uv_timer_.Start(FROM_HERE, base::TimeDelta::FromMilliseconds(timeout),
+                    base::BindOnce(&NodeBindingsLinux::ScheduleUvRunOnce,
+                                   base::Unretained(this)));
+  }
+}
+
 // static
 void NodeBindingsLinux::OnWatcherQueueChanged(uv_loop_t* loop) {
   NodeBindingsLinux* self = static_cast<NodeBindingsLinux*>(loop->data);
 
+  // New watchers only reach the backend fd when the loop runs, so give it a
+  // turn on the main thread instead of waiting for an unrelated event.
+  if (self->watching_backend_fd_) {
+    self->ScheduleUvRunOnce();
+    return;
+  }
+
   // We need to break the io polling in the epoll thread when loop's watcher
   // queue changes, otherwise new events cannot be notified.
   self->WakeupEmbedThread();
@@ -47,6 +101,31 @@ void NodeBindingsLinux::PollEvents() {
   } while (r == -1 && errno == EINTR);
 }
 
+#if defined(USE_OZONE)
+void NodeBindingsLinux::OnFileCanReadWithoutBlocking(int fd) {
+  ScheduleUvRunOnce();
+}
+
+void NodeBindingsLinux::OnFileCanWriteWithoutBlocking(int fd) {
+  NOTREACHED();
+}
+#endif
+
+void NodeBindingsLinux::ScheduleUvRunOnce() {
+  if (uv_run_pending_)
+    return;
+  uv_run_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&NodeBindingsLinux::DoUvRunOnce,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void NodeBindingsLinux::DoUvRunOnce() {
+  uv_run_pending_ = false;
+  uv_timer_.Stop();
+  UvRunOnce();
+}
+
 // static
 NodeBindings* NodeBindings::Create(BrowserEnvironment browser_env) {
   return new NodeBindingsLinux(browser_env);
@@ -5,27 +5,67 @@
 #ifndef SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 #define SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 
+#include <memory>
+
 #include "base/compiler_specific.h"
+#include "base/memory/weak_ptr.h"
+#include "base/message_loop/message_pump_for_ui.h"
+#include "base/timer/timer.h"
 #include "shell/common/node_bindings.h"
 
 namespace electron {
 
+#if defined(USE_OZONE)
+class NodeBindingsLinux : public NodeBindings,
+                          public base::MessagePumpForUI::FdWatcher {
+#else
 class NodeBindingsLinux : public NodeBindings {
+#endif
  public:
   explicit NodeBindingsLinux(BrowserEnvironment browser_env);
   ~NodeBindingsLinux() override;
 
   void RunMessageLoop() override;
 
+ protected:
+  // NodeBindings:
+  bool WatchBackendFd() override;
+  void ResumePolling() override;
+
  private:
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
   void PollEvents() override;
 
+#if defined(USE_OZONE)
+  // base::MessagePumpForUI::FdWatcher:
+  void OnFileCanReadWithoutBlocking(int fd) override;
+  void OnFileCanWriteWithoutBlocking(int fd) override;
+#endif
+
+  // Posts a UvRunOnce to the current thread unless one is pending already.
+  void ScheduleUvRunOnce();
+  void DoUvRunOnce();
+
   // Epoll to poll for uv's backend fd.
   int epoll_;
 
+  // Set when uv's backend fd is watched by the UI thread's message pump
+  // instead of the embed thread.
+  bool watching_backend_fd_ = false;
+  bool uv_run_pending_ = false;
+
+#if defined(USE_OZONE)
+  std::unique_ptr<base::MessagePumpForUI::FdWatchController>
+      backend_fd_controller_;
+#endif
+
+  // Fires when the nearest uv timer is due.
+  base::OneShotTimer uv_timer_;
+
+  base::WeakPtrFactory<NodeBindingsLinux> weak_factory_{this};
+
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsLinux);
 };
 
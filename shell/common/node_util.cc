@@ -3,7 +3,23 @@
 // found in the LICENSE file.
 
 #include "shell/common/node_util.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
 #include "base/logging.h"
+#include "base/memory/ptr_util.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_util.h"
+#include "base/synchronization/lock.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/thread_restrictions.h"
+#include "electron/electron_version.h"
+#include "gin/converter.h"
 #include "shell/common/node_includes.h"
 #include "third_party/electron_node/src/node_native_module_env.h"
 
@@ -11,6 +27,127 @@ namespace electron {
 
 namespace util {
 
+namespace {
+
+// V8 code caches for the js2c bundles, keyed by bundle id. Entries are
+// produced the first time a bundle runs in a process so later frames and
+// worker threads can skip parsing, and are persisted to |directory| in the
+// browser process.
+struct CodeCacheState {
+  base::Lock lock;
+  base::FilePath directory GUARDED_BY(lock);
+  std::map<std::string, std::string> entries GUARDED_BY(lock);
+};
+
+CodeCacheState& GetCodeCacheState() {
+  static base::NoDestructor<CodeCacheState> state;
+  return *state;
+}
+
+base::FilePath GetCodeCacheFilePath(const base::FilePath& directory,
+                                    const std::string& id) {
+  std::string file_name;
+  base::ReplaceChars(id, "/", "_", &file_name);
+  return directory.AppendASCII(ELECTRON_VERSION_STRING)
+      .AppendASCII(file_name + ".bin");
+}
+
+bool ReadCodeCache(const std::string& id, std::string* data) {
+  CodeCacheState& state = GetCodeCacheState();
+  base::FilePath directory;
+  {
+    base::AutoLock auto_lock(state.lock);
+    auto it = state.entries.find(id);
+    if (it != state.entries.end()) {
+      *data = it->second;
+      return true;
+    }
+    directory = state.directory;
+  }
+  if (directory.empty())
+    return false;
+
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  if (!base::ReadFileToString(GetCodeCacheFilePath(directory, id), data) ||
+      data->empty())
+    return false;
+
+  base::AutoLock auto_lock(state.lock);
+  state.entries.emplace(id, *data);
+  return true;
+}
+
+void WriteCodeCacheFile(const base::FilePath& path, const std::string& data) {
+  if (!base::CreateDirectory(path.DirName()))
+    return;
+  base::ImportantFileWriter::WriteFileAtomically(path, data);
+}
+
+void StoreCodeCache(const std::string& id,
+                    std::unique_ptr<v8::ScriptCompiler::CachedData> cache) {
+  if (!cache || cache->length <= 0)
+    return;
+  std::string data(reinterpret_cast<const char*>(cache->data), cache->length);
+
+  CodeCacheState& state = GetCodeCacheState();
+  base::FilePath directory;
+  {
+    base::AutoLock auto_lock(state.lock);
+    state.entries[id] = data;
+    directory = state.directory;
+  }
+  if (directory.empty())
+    return;
+
+  base::ThreadPool::PostTask(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&WriteCodeCacheFile, GetCodeCacheFilePath(directory, id),
+                     std::move(data)));
+}
+
+// Compiles the bundle |id| the same way node's LookupAndCompile does, but
+// consumes |cached_data| when it is given. Sets |cache_rejected| when V8
+// refuses the cache, e.g. because V8 flags changed since it was produced.
+v8::MaybeLocal<v8::Function> CompileWithCodeCache(
+    v8::Local<v8::Context> context,
+    const char* id,
+    std::vector<v8::Local<v8::String>>* parameters,
+    const std::string& cached_data,
+    bool* cache_rejected) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::Local<v8::String> id_string = gin::StringToV8(isolate, id);
+  v8::Local<v8::Value> source;
+  if (!node::native_module::NativeModuleEnv::GetSourceObject(context)
+           ->Get(context, id_string)
+           .ToLocal(&source) ||
+      !source->IsString())
+    return v8::MaybeLocal<v8::Function>();
+
+  // The CachedData does not own the buffer, |cached_data| outlives it.
+  auto* cache = new v8::ScriptCompiler::CachedData(
+      reinterpret_cast<const uint8_t*>(cached_data.data()),
+      static_cast<int>(cached_data.size()));
+  v8::ScriptOrigin origin(gin::StringToV8(isolate, std::string(id) + ".js"));
+  v8::ScriptCompiler::Source script_source(source.As<v8::String>(), origin,
+                                           cache);
+  v8::MaybeLocal<v8::Function> maybe_fn =
+      v8::ScriptCompiler::CompileFunctionInContext(
+          context, &script_source, parameters->size(), parameters->data(), 0,
+          nullptr, v8::ScriptCompiler::kConsumeCodeCache);
+  *cache_rejected = script_source.GetCachedData()->rejected;
+  return maybe_fn;
+}
+
+}  // namespace
+
+void SetCodeCacheDirectory(const base::FilePath& directory) {
+  CodeCacheState& state = GetCodeCacheState();
+  base::AutoLock auto_lock(state.lock);
+  state.directory = directory;
+}
+
 v8::MaybeLocal<v8::Value> CompileAndCall(
     v8::Local<v8::Context> context,
     const char* id,
@@ -19,9 +156,21 @@ v8::MaybeLocal<v8::Value> CompileAndCall(
     node::Environment* optional_env) {
   v8::Isolate* isolate = context->GetIsolate();
   v8::TryCatch try_catch(isolate);
-  v8::MaybeLocal<v8::Function> compiled =
-      node::native_module::NativeModuleEnv::LookupAndCompile(
-          context, id, parameters, optional_env);
+
+  v8::MaybeLocal<v8::Function> compiled;
+  std::string cached_data;
+  bool needs_cache = true;
+  if (ReadCodeCache(id, &cached_data)) {
+    bool cache_rejected = false;
+    compiled = CompileWithCodeCache(context, id, parameters, cached_data,
+                                    &cache_rejected);
+    needs_cache = compiled.IsEmpty() || cache_rejected;
+  }
+  if (compiled.IsEmpty()) {
+    try_catch.Reset();
+    compiled = node::native_module::NativeModuleEnv::LookupAndCompile(
+        context, id, parameters, optional_env);
+  }
   if (compiled.IsEmpty()) {
     return v8::MaybeLocal<v8::Value>();
   }
@@ -32,6 +181,11 @@ v8::MaybeLocal<v8::Value> CompileAndCall(
   // electron scripts are wrapped in a try {} catch {} by webpack
   if (try_catch.HasCaught()) {
     LOG(ERROR) << "Failed to CompileAndCall electron script: " << id;
+  } else if (needs_cache) {
+    // Produce the cache after running the bundle so that the functions it
+    // compiled lazily during startup are included as well.
+    StoreCodeCache(id, base::WrapUnique(
+                           v8::ScriptCompiler::CreateCodeCacheForFunction(fn)));
   }
   return ret;
 }
@@ -7,6 +7,7 @@
 
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "v8/include/v8.h"
 
 namespace node {
@@ -22,6 +23,8 @@ namespace util {
 // The returned value is empty if an exception is encountered.
 // JS code run with this method can assume that their top-level
 // declarations won't affect the global scope.
+// The V8 code cache produced by the first run is reused by later calls in
+// the same process, and by later launches when a code cache directory is set.
 v8::MaybeLocal<v8::Value> CompileAndCall(
     v8::Local<v8::Context> context,
     const char* id,
@@ -29,6 +32,12 @@ v8::MaybeLocal<v8::Value> CompileAndCall(
     std::vector<v8::Local<v8::Value>>* arguments,
     node::Environment* optional_env);
 
+// Persist the code caches of CompileAndCall under |directory|. Only the
+// browser process may set it: the caches are run without checking where they
+// came from, so a directory that renderers can write to would let them inject
+// code into the browser.
+void SetCodeCacheDirectory(const base::FilePath& directory);
+
 }  // namespace util
 
 }  // namespace electron
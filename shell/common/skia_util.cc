@@ -2,13 +2,22 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 
-#include "base/files/file_util.h"
+#include "base/containers/mru_cache.h"
+#include "base/files/file.h"
+#include "base/no_destructor.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
 #include "net/base/data_url.h"
+#include "shell/common/asar/archive.h"
 #include "shell/common/asar/asar_util.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/skia_util.h"
@@ -42,6 +51,138 @@ ScaleFactorPair kScaleFactorPairs[] = {
     {"@1.5x", 1.5f}, {"@1.8x", 1.8f},   {"@2.5x", 2.5f},
 };
 
+namespace {
+
+// Upper bound of pixel memory retained by the decoded image cache.
+constexpr size_t kMaxDecodedImageCacheBytes = 32 * 1024 * 1024;
+
+// Identifies one version of an image file on disk.
+struct ImageFileStamp {
+  base::Time last_modified;
+  int64_t size = 0;
+
+  bool operator==(const ImageFileStamp& other) const {
+    return last_modified == other.last_modified && size == other.size;
+  }
+};
+
+// An image file opened for reading, with the stamp of the opened version.
+struct ImageFile {
+  base::File file;
+  int64_t offset = 0;
+  ImageFileStamp stamp;
+};
+
+// Opens |path| and stamps it from the opened handle, so that looking up the
+// cache costs no more file system calls than reading the file would.
+bool OpenImageFile(const base::FilePath& path, ImageFile* image_file) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::FilePath file_path(path);
+  int64_t size = -1;
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path)) {
+    std::shared_ptr<asar::Archive> archive =
+        asar::GetOrCreateAsarArchive(asar_path);
+    asar::Archive::FileInfo info;
+    if (!archive || !archive->GetFileInfo(relative_path, &info))
+      return false;
+    if (info.unpacked) {
+      // For unpacked file it will return the real path instead of doing the
+      // copy.
+      archive->CopyFileOut(relative_path, &file_path);
+    } else {
+      // Packed files can only change together with the archive itself.
+      file_path = asar_path;
+      image_file->offset = info.offset;
+      size = info.size;
+    }
+  }
+
+  image_file->file.Initialize(file_path,
+                              base::File::FLAG_OPEN | base::File::FLAG_READ);
+  base::File::Info info;
+  if (!image_file->file.IsValid() || !image_file->file.GetInfo(&info) ||
+      info.is_directory)
+    return false;
+  image_file->stamp.size = size >= 0 ? size : info.size;
+  image_file->stamp.last_modified = info.last_modified;
+  return true;
+}
+
+// Process-wide cache of decoded image files. Accessed from both the main
+// thread and the thread pool, so every operation takes |lock_|.
+class DecodedImageCache {
+ public:
+  static DecodedImageCache* GetInstance() {
+    static base::NoDestructor<DecodedImageCache> instance;
+    return instance.get();
+  }
+
+  bool Get(const base::FilePath& path,
+           const ImageFileStamp& stamp,
+           SkBitmap* bitmap) {
+    base::AutoLock auto_lock(lock_);
+    auto it = entries_.Get(path);
+    if (it == entries_.end())
+      return false;
+    if (!(it->second.stamp == stamp)) {
+      EraseLocked(it);
+      return false;
+    }
+    *bitmap = it->second.bitmap;
+    return true;
+  }
+
+  void Put(const base::FilePath& path,
+           const ImageFileStamp& stamp,
+           const SkBitmap& bitmap) {
+    size_t bytes = bitmap.computeByteSize();
+    if (bytes > kMaxDecodedImageCacheBytes / 4)
+      return;
+
+    base::AutoLock auto_lock(lock_);
+    auto it = entries_.Peek(path);
+    if (it != entries_.end())
+      EraseLocked(it);
+    while (!entries_.empty() &&
+           total_bytes_ + bytes > kMaxDecodedImageCacheBytes) {
+      EraseLocked(entries_.rbegin());
+    }
+    entries_.Put(path, Entry{stamp, bitmap});
+    total_bytes_ += bytes;
+  }
+
+ private:
+  friend class base::NoDestructor<DecodedImageCache>;
+
+  struct Entry {
+    ImageFileStamp stamp;
+    SkBitmap bitmap;
+  };
+  using EntryMap = base::MRUCache<base::FilePath, Entry>;
+
+  DecodedImageCache() : entries_(EntryMap::NO_AUTO_EVICT) {}
+
+  void EraseLocked(EntryMap::iterator it) EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    total_bytes_ -= it->second.bitmap.computeByteSize();
+    entries_.Erase(it);
+  }
+
+  void EraseLocked(EntryMap::reverse_iterator it)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    total_bytes_ -= it->second.bitmap.computeByteSize();
+    entries_.Erase(it);
+  }
+
+  base::Lock lock_;
+  EntryMap entries_ GUARDED_BY(lock_);
+  size_t total_bytes_ GUARDED_BY(lock_) = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace
+
 float GetScaleFactorFromPath(const base::FilePath& path) {
   std::string filename(path.BaseName().RemoveExtension().AsUTF8Unsafe());
 
@@ -89,19 +230,23 @@ bool AddImageSkiaRepFromJPEG(gfx::ImageSkia* image,
   return true;
 }
 
-bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
-                               const unsigned char* data,
-                               size_t size,
-                               int width,
-                               int height,
-                               double scale_factor) {
+bool DecodeImageFromBuffer(const unsigned char* data,
+                           size_t size,
+                           int width,
+                           int height,
+                           SkBitmap* bitmap) {
   // Try PNG first.
-  if (AddImageSkiaRepFromPNG(image, data, size, scale_factor))
+  if (gfx::PNGCodec::Decode(data, size, bitmap))
     return true;
 
   // Try JPEG second.
-  if (AddImageSkiaRepFromJPEG(image, data, size, scale_factor))
+  auto jpeg = gfx::JPEGCodec::Decode(data, size);
+  if (jpeg) {
+    // See the comment in AddImageSkiaRepFromJPEG().
+    jpeg->setAlphaType(SkAlphaType::kOpaque_SkAlphaType);
+    *bitmap = std::move(*jpeg);
     return true;
+  }
 
   if (width == 0 || height == 0)
     return false;
@@ -110,46 +255,88 @@ bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
   if (size < info.computeMinByteSize())
     return false;
 
+  bitmap->allocN32Pixels(width, height, false);
+  bitmap->writePixels({info, data, bitmap->rowBytes()});
+  return true;
+}
+
+bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
+                               const unsigned char* data,
+                               size_t size,
+                               int width,
+                               int height,
+                               double scale_factor) {
   SkBitmap bitmap;
-  bitmap.allocN32Pixels(width, height, false);
-  bitmap.writePixels({info, data, bitmap.rowBytes()});
+  if (!DecodeImageFromBuffer(data, size, width, height, &bitmap))
+    return false;
 
   image->AddRepresentation(gfx::ImageSkiaRep(bitmap, scale_factor));
   return true;
 }
 
-bool AddImageSkiaRepFromPath(gfx::ImageSkia* image,
-                             const base::FilePath& path,
-                             double scale_factor) {
-  std::string file_contents;
+bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
+                                   const base::FilePath& path) {
+  std::vector<gfx::ImageSkiaRep> reps;
+  if (!DecodeImageSkiaRepsFromPath(path, &reps))
+    return false;
+
+  for (const auto& rep : reps)
+    image->AddRepresentation(rep);
+  return true;
+}
+
+bool DecodeImageSkiaRepsFromPath(const base::FilePath& path,
+                                 std::vector<gfx::ImageSkiaRep>* reps) {
+  SkBitmap bitmap;
+  std::string filename(path.BaseName().RemoveExtension().AsUTF8Unsafe());
+  if (base::MatchPattern(filename, "*@*x")) {
+    // Don't search for other representations if the DPI has been specified.
+    if (DecodeImageFromPath(path, &bitmap))
+      reps->emplace_back(bitmap, GetScaleFactorFromPath(path));
+    return !reps->empty();
+  }
+
+  if (DecodeImageFromPath(path, &bitmap))
+    reps->emplace_back(bitmap, 1.0f);
+  for (const ScaleFactorPair& pair : kScaleFactorPairs) {
+    if (DecodeImageFromPath(path.InsertBeforeExtensionASCII(pair.name),
+                            &bitmap))
+      reps->emplace_back(bitmap, pair.scale);
+  }
+  return !reps->empty();
+}
+
+bool DecodeImageFromPath(const base::FilePath& path, SkBitmap* bitmap) {
+  ImageFile image_file;
+  if (!OpenImageFile(path, &image_file))
+    return false;
+
+  auto* cache = DecodedImageCache::GetInstance();
+  if (cache->Get(path, image_file.stamp, bitmap))
+    return true;
+
+  if (image_file.stamp.size > std::numeric_limits<int>::max())
+    return false;
+  std::string file_contents(image_file.stamp.size, '\0');
   {
     base::ThreadRestrictions::ScopedAllowIO allow_io;
-    if (!asar::ReadFileToString(path, &file_contents))
+    if (image_file.file.Read(image_file.offset, &file_contents[0],
+                             file_contents.size()) !=
+        static_cast<int>(file_contents.size()))
       return false;
   }
 
   const auto* data =
       reinterpret_cast<const unsigned char*>(file_contents.data());
-  size_t size = file_contents.size();
+  if (!DecodeImageFromBuffer(data, file_contents.size(), 0, 0, bitmap))
+    return false;
 
-  return AddImageSkiaRepFromBuffer(image, data, size, 0, 0, scale_factor);
+  // The pixels are shared by every image loaded from this file from now on.
+  bitmap->setImmutable();
+  cache->Put(path, image_file.stamp, *bitmap);
+  return true;
 }
 
-bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
-                                   const base::FilePath& path) {
-  bool succeed = false;
-  std::string filename(path.BaseName().RemoveExtension().AsUTF8Unsafe());
-  if (base::MatchPattern(filename, "*@*x"))
-    // Don't search for other representations if the DPI has been specified.
-    return AddImageSkiaRepFromPath(image, path, GetScaleFactorFromPath(path));
-  else
-    succeed |= AddImageSkiaRepFromPath(image, path, 1.0f);
-
-  for (const ScaleFactorPair& pair : kScaleFactorPairs)
-    succeed |= AddImageSkiaRepFromPath(
-        image, path.InsertBeforeExtensionASCII(pair.name), pair.scale);
-  return succeed;
-}
 #if defined(OS_WIN)
 bool ReadImageSkiaFromICO(gfx::ImageSkia* image, HICON icon) {
   // Convert the icon from the Windows specific HICON to gfx::ImageSkia.
@@ -6,8 +6,13 @@
 #define SHELL_COMMON_SKIA_UTIL_H_
 
 #include <string>
+#include <vector>
 
+#include "base/files/file_path.h"
 #include "ui/gfx/image/image_skia.h"
+#include "ui/gfx/image/image_skia_rep.h"
+
+class SkBitmap;
 
 namespace electron {
 
@@ -16,6 +21,27 @@ namespace util {
 bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
                                    const base::FilePath& path);
 
+// Decodes the representations that PopulateImageSkiaRepsFromPath would add
+// for |path|, including its scale variants such as "icon@2x.png", into |reps|.
+// Safe to call on any sequence that allows blocking.
+bool DecodeImageSkiaRepsFromPath(const base::FilePath& path,
+                                 std::vector<gfx::ImageSkiaRep>* reps);
+
+// Decodes the PNG or JPEG file at |path| into |bitmap|. Results are kept in a
+// process-wide cache keyed by path and modification time, so repeated loads of
+// an unchanged file are not read or decoded again. Safe to call on any
+// sequence that allows blocking.
+bool DecodeImageFromPath(const base::FilePath& path, SkBitmap* bitmap);
+
+// Decodes |data| as PNG, then JPEG, then as raw N32 pixels when |width| and
+// |height| are given. Does not touch any V8 or UI state, so it may run on any
+// sequence.
+bool DecodeImageFromBuffer(const unsigned char* data,
+                           size_t size,
+                           int width,
+                           int height,
+                           SkBitmap* bitmap);
+
 bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
                                const unsigned char* data,
                                size_t size,
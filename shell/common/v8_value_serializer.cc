@@ -23,6 +23,12 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
       : isolate_(isolate), serializer_(isolate, this) {}
   ~V8Serializer() override = default;
 
+  void TransferArrayBuffers(
+      const std::vector<v8::Local<v8::ArrayBuffer>>& array_buffers) {
+    for (size_t i = 0; i < array_buffers.size(); ++i)
+      serializer_.TransferArrayBuffer(i, array_buffers[i]);
+  }
+
   bool Serialize(v8::Local<v8::Value> value, blink::CloneableMessage* out) {
     WriteBlinkEnvelope(19);
 
@@ -86,6 +92,12 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
   V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
       : V8Deserializer(isolate, message.encoded_message) {}
 
+  void TransferArrayBuffers(
+      const std::vector<v8::Local<v8::ArrayBuffer>>& array_buffers) {
+    for (size_t i = 0; i < array_buffers.size(); ++i)
+      deserializer_.TransferArrayBuffer(i, array_buffers[i]);
+  }
+
   v8::Local<v8::Value> Deserialize() {
     v8::EscapableHandleScope scope(isolate_);
     auto context = isolate_->GetCurrentContext();
@@ -134,11 +146,30 @@ bool SerializeV8Value(v8::Isolate* isolate,
   return V8Serializer(isolate).Serialize(value, out);
 }
 
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    const std::vector<v8::Local<v8::ArrayBuffer>>& transferred_array_buffers,
+    blink::CloneableMessage* out) {
+  V8Serializer serializer(isolate);
+  serializer.TransferArrayBuffers(transferred_array_buffers);
+  return serializer.Serialize(value, out);
+}
+
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in) {
   return V8Deserializer(isolate, in).Deserialize();
 }
 
+v8::Local<v8::Value> DeserializeV8Value(
+    v8::Isolate* isolate,
+    const blink::CloneableMessage& in,
+    const std::vector<v8::Local<v8::ArrayBuffer>>& transferred_array_buffers) {
+  V8Deserializer deserializer(isolate, in);
+  deserializer.TransferArrayBuffers(transferred_array_buffers);
+  return deserializer.Deserialize();
+}
+
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data) {
   return V8Deserializer(isolate, data).Deserialize();
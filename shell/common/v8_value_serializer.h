@@ -5,9 +5,12 @@
 #ifndef SHELL_COMMON_V8_VALUE_SERIALIZER_H_
 #define SHELL_COMMON_V8_VALUE_SERIALIZER_H_
 
+#include <vector>
+
 #include "base/containers/span.h"
 
 namespace v8 {
+class ArrayBuffer;
 class Isolate;
 template <class T>
 class Local;
@@ -23,8 +26,24 @@ namespace electron {
 bool SerializeV8Value(v8::Isolate* isolate,
                       v8::Local<v8::Value> value,
                       blink::CloneableMessage* out);
+// Serializes |value| with each buffer in |transferred_array_buffers| written
+// as a reference to its index in that list rather than as a copy of its
+// contents. The caller is responsible for moving the contents of those buffers
+// alongside the message, in the same order.
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    const std::vector<v8::Local<v8::ArrayBuffer>>& transferred_array_buffers,
+    blink::CloneableMessage* out);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in);
+// Deserializes a message produced with transferred buffers, resolving each
+// buffer reference to the entry at the same index in
+// |transferred_array_buffers|.
+v8::Local<v8::Value> DeserializeV8Value(
+    v8::Isolate* isolate,
+    const blink::CloneableMessage& in,
+    const std::vector<v8::Local<v8::ArrayBuffer>>& transferred_array_buffers);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data);
 
@@ -4,9 +4,11 @@
 
 #include "shell/renderer/api/context_bridge/object_cache.h"
 
+#include <algorithm>
 #include <utility>
 
-#include "shell/common/api/object_life_monitor.h"
+#include "base/no_destructor.h"
+#include "base/trace_event/trace_event.h"
 
 namespace electron {
 
@@ -14,8 +16,74 @@ namespace api {
 
 namespace context_bridge {
 
-ObjectCache::ObjectCache() {}
-ObjectCache::~ObjectCache() = default;
+namespace {
+
+// Must be a power of two.
+const size_t kInitialCapacity = 64;
+
+// Tables that grew beyond this are freed rather than pooled.
+const size_t kMaxPooledCapacity = 4096;
+
+// The context bridge only runs on the renderer main thread, so the pool
+// needs no locking. It holds one table per ObjectCache alive at once, which
+// is more than one when bridge calls nest.
+std::vector<std::vector<ObjectCache::Entry>>& GetTablePool() {
+  static base::NoDestructor<std::vector<std::vector<ObjectCache::Entry>>> pool;
+  return *pool;
+}
+
+size_t g_total_hits = 0;
+size_t g_total_misses = 0;
+
+}  // namespace
+
+ObjectCache::ObjectCache() {
+  auto& pool = GetTablePool();
+  if (!pool.empty()) {
+    entries_ = std::move(pool.back());
+    pool.pop_back();
+  } else {
+    entries_.resize(kInitialCapacity);
+  }
+}
+
+ObjectCache::~ObjectCache() {
+  if (hits_ || misses_) {
+    g_total_hits += hits_;
+    g_total_misses += misses_;
+    TRACE_COUNTER2("electron", "ContextBridge::ObjectCache", "hits",
+                   g_total_hits, "misses", g_total_misses);
+  }
+
+  if (entries_.size() > kMaxPooledCapacity)
+    return;
+  // The handles are only valid within the caller's HandleScope, don't let
+  // the next user of this table see them.
+  if (size_)
+    std::fill(entries_.begin(), entries_.end(), Entry());
+  GetTablePool().push_back(std::move(entries_));
+}
+
+size_t ObjectCache::FindSlot(int hash, v8::Local<v8::Value> from) const {
+  size_t mask = entries_.size() - 1;
+  size_t index = static_cast<size_t>(hash) & mask;
+  while (!entries_[index].from.IsEmpty()) {
+    const Entry& entry = entries_[index];
+    if (entry.hash == hash && entry.from == from)
+      break;
+    index = (index + 1) & mask;
+  }
+  return index;
+}
+
+void ObjectCache::Grow() {
+  std::vector<Entry> old_entries(entries_.size() * 2);
+  old_entries.swap(entries_);
+  for (const Entry& entry : old_entries) {
+    if (!entry.from.IsEmpty())
+      entries_[FindSlot(entry.hash, entry.from)] = entry;
+  }
+}
 
 void ObjectCache::CacheProxiedObject(v8::Local<v8::Value> from,
                                      v8::Local<v8::Value> proxy_value) {
@@ -23,7 +91,18 @@ void ObjectCache::CacheProxiedObject(v8::Local<v8::Value> from,
     auto obj = v8::Local<v8::Object>::Cast(from);
     int hash = obj->GetIdentityHash();
 
-    proxy_map_[hash].push_front(std::make_pair(from, proxy_value));
+    // Keep the load factor at or below one half so probe sequences stay
+    // short.
+    if ((size_ + 1) * 2 > entries_.size())
+      Grow();
+
+    Entry& entry = entries_[FindSlot(hash, from)];
+    if (entry.from.IsEmpty()) {
+      entry.hash = hash;
+      entry.from = from;
+      size_++;
+    }
+    entry.proxy_value = proxy_value;
   }
 }
 
@@ -34,20 +113,13 @@ v8::MaybeLocal<v8::Value> ObjectCache::GetCachedProxiedObject(
 
   auto obj = v8::Local<v8::Object>::Cast(from);
   int hash = obj->GetIdentityHash();
-  auto iter = proxy_map_.find(hash);
-  if (iter == proxy_map_.end())
+  const Entry& entry = entries_[FindSlot(hash, from)];
+  if (entry.from.IsEmpty() || entry.proxy_value.IsEmpty()) {
+    misses_++;
     return v8::MaybeLocal<v8::Value>();
-
-  auto& list = iter->second;
-  for (const auto& pair : list) {
-    auto from_cmp = pair.first;
-    if (from_cmp == from) {
-      if (pair.second.IsEmpty())
-        return v8::MaybeLocal<v8::Value>();
-      return pair.second;
-    }
   }
-  return v8::MaybeLocal<v8::Value>();
+  hits_++;
+  return entry.proxy_value;
 }
 
 }  // namespace context_bridge
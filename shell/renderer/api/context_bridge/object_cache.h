@@ -5,14 +5,10 @@
 #ifndef SHELL_RENDERER_API_CONTEXT_BRIDGE_OBJECT_CACHE_H_
 #define SHELL_RENDERER_API_CONTEXT_BRIDGE_OBJECT_CACHE_H_
 
-#include <unordered_map>
-#include <utility>
+#include <vector>
 
-#include "base/containers/linked_list.h"
-#include "content/public/renderer/render_frame.h"
-#include "content/public/renderer/render_frame_observer.h"
-#include "shell/renderer/electron_render_frame_observer.h"
-#include "third_party/blink/public/web/web_local_frame.h"
+#include "base/macros.h"
+#include "v8/include/v8.h"
 
 namespace electron {
 
@@ -20,10 +16,21 @@ namespace api {
 
 namespace context_bridge {
 
-using ObjectCachePair = std::pair<v8::Local<v8::Value>, v8::Local<v8::Value>>;
-
+// Maps objects passed over the context bridge to the value they were proxied
+// or copied to, for the duration of a single bridge call.
+//
+// This is an open addressing hash table keyed by the V8 identity hash, with
+// linear probing over a flat array. The array is borrowed from a pool when
+// the cache is created and handed back, emptied, when it is destroyed so
+// consecutive calls don't reallocate it.
 class ObjectCache final {
  public:
+  struct Entry {
+    int hash = 0;
+    v8::Local<v8::Value> from;
+    v8::Local<v8::Value> proxy_value;
+  };
+
   ObjectCache();
   ~ObjectCache();
 
@@ -33,8 +40,17 @@ class ObjectCache final {
       v8::Local<v8::Value> from) const;
 
  private:
-  // object_identity ==> [from_value, proxy_value]
-  std::unordered_map<int, std::forward_list<ObjectCachePair>> proxy_map_;
+  // Returns the slot holding |from|, or the empty slot it would go in.
+  size_t FindSlot(int hash, v8::Local<v8::Value> from) const;
+  void Grow();
+
+  std::vector<Entry> entries_;
+  size_t size_ = 0;
+
+  mutable size_t hits_ = 0;
+  mutable size_t misses_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(ObjectCache);
 };
 
 }  // namespace context_bridge
@@ -28,6 +28,9 @@ namespace api {
 
 namespace {
 
+// Comfortably covers the vocabulary of a long document.
+constexpr size_t kVerdictCacheSize = 10000;
+
 bool HasWordCharacters(const std::u16string& text, int index) {
   const char16_t* data = text.data();
   int length = text.length();
@@ -62,10 +65,14 @@ class SpellCheckClient::SpellcheckRequest {
   const std::u16string& text() const { return text_; }
   blink::WebTextCheckingCompletion* completion() { return completion_.get(); }
   std::vector<Word>& wordlist() { return word_list_; }
+  std::unordered_set<std::u16string>& misspelled() { return misspelled_; }
 
  private:
   std::u16string text_;          // Text to be checked in this task.
   std::vector<Word> word_list_;  // List of Words found in text
+  // Words of |word_list_| known to be misspelled, including the parts of
+  // contractions.
+  std::unordered_set<std::u16string> misspelled_;
   // The interface to send the misspelled ranges to WebKit.
   std::unique_ptr<blink::WebTextCheckingCompletion> completion_;
 };
@@ -73,7 +80,8 @@ class SpellCheckClient::SpellcheckRequest {
 SpellCheckClient::SpellCheckClient(const std::string& language,
                                    v8::Isolate* isolate,
                                    v8::Local<v8::Object> provider)
-    : isolate_(isolate),
+    : verdict_cache_(kVerdictCacheSize),
+      isolate_(isolate),
       context_(isolate, isolate->GetCurrentContext()),
       provider_(isolate, provider) {
   DCHECK(!context_.IsEmpty());
@@ -90,6 +98,11 @@ SpellCheckClient::~SpellCheckClient() {
   context_.Reset();
 }
 
+void SpellCheckClient::ClearVerdictCache() {
+  verdict_cache_.Clear();
+  ++cache_generation_;
+}
+
 void SpellCheckClient::RequestCheckingOfText(
     const blink::WebString& textToCheck,
     std::unique_ptr<blink::WebTextCheckingCompletion> completionCallback) {
@@ -181,15 +194,47 @@ void SpellCheckClient::SpellCheckText() {
     }
   }
 
-  // Send out all the words data to the spellchecker to check
-  SpellCheckWords(scope, words);
+  // Only words without a cached verdict have to go to the provider.
+  std::set<std::u16string> unknown_words;
+  auto& misspelled = pending_request_param_->misspelled();
+  for (const auto& w : words) {
+    auto it = verdict_cache_.Get(w);
+    if (it == verdict_cache_.end())
+      unknown_words.insert(w);
+    else if (it->second)
+      misspelled.insert(w);
+  }
+
+  if (unknown_words.empty()) {
+    FinishPendingRequest();
+    return;
+  }
+
+  // Send out the remaining words to the spellchecker to check
+  SpellCheckWords(scope, unknown_words);
 }
 
 void SpellCheckClient::OnSpellCheckDone(
+    const std::set<std::u16string>& checked_words,
+    uint32_t cache_generation,
     const std::vector<std::u16string>& misspelled_words) {
-  std::vector<blink::WebTextCheckingResult> results;
   std::unordered_set<std::u16string> misspelled(misspelled_words.begin(),
                                                 misspelled_words.end());
+  if (cache_generation == cache_generation_) {
+    for (const auto& word : checked_words)
+      verdict_cache_.Put(word, misspelled.count(word) > 0);
+  }
+
+  if (!pending_request_param_)
+    return;
+  pending_request_param_->misspelled().insert(misspelled.begin(),
+                                              misspelled.end());
+  FinishPendingRequest();
+}
+
+void SpellCheckClient::FinishPendingRequest() {
+  std::vector<blink::WebTextCheckingResult> results;
+  const auto& misspelled = pending_request_param_->misspelled();
 
   auto& word_list = pending_request_param_->wordlist();
 
@@ -220,8 +265,8 @@ void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
   DCHECK(!scope.spell_check_.IsEmpty());
 
   v8::Local<v8::FunctionTemplate> templ = gin_helper::CreateFunctionTemplate(
-      isolate_,
-      base::BindRepeating(&SpellCheckClient::OnSpellCheckDone, AsWeakPtr()));
+      isolate_, base::BindRepeating(&SpellCheckClient::OnSpellCheckDone,
+                                    AsWeakPtr(), words, cache_generation_));
 
   auto context = isolate_->GetCurrentContext();
   v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate_, words),
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/callback.h"
+#include "base/containers/mru_cache.h"
 #include "base/memory/weak_ptr.h"
 #include "components/spellcheck/renderer/spellcheck_worditerator.h"
 #include "third_party/blink/public/platform/web_spell_check_panel_host_client.h"
@@ -36,6 +37,11 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
                    v8::Local<v8::Object> provider);
   ~SpellCheckClient() override;
 
+  // Forget every cached verdict, e.g. after the provider's dictionary has
+  // changed. Words are sent to the provider again the next time they are
+  // checked.
+  void ClearVerdictCache();
+
  private:
   class SpellcheckRequest;
   // blink::WebTextCheckClient:
@@ -71,6 +77,9 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   void SpellCheckWords(const SpellCheckScope& scope,
                        const std::set<std::u16string>& words);
 
+  // Report the misspelled words of the pending request to blink.
+  void FinishPendingRequest();
+
   // Returns whether or not the given word is a contraction of valid words
   // (e.g. "word:word").
   // Output variable contraction_words will contain individual
@@ -79,8 +88,11 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
                      const std::u16string& contraction,
                      std::vector<std::u16string>* contraction_words);
 
-  // Callback for the JS API which returns the list of misspelled words.
-  void OnSpellCheckDone(const std::vector<std::u16string>& misspelled_words);
+  // Callback for the JS API which returns the list of misspelled words out of
+  // |checked_words|.
+  void OnSpellCheckDone(const std::set<std::u16string>& checked_words,
+                        uint32_t cache_generation,
+                        const std::vector<std::u16string>& misspelled_words);
 
   // Represents character attributes used for filtering out characters which
   // are not supported by this SpellCheck object.
@@ -99,6 +111,14 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
 
+  // Whether each recently checked word is misspelled, so that words which
+  // were verified a keystroke ago are not sent to the provider again.
+  base::HashingMRUCache<std::u16string, bool> verdict_cache_;
+
+  // Bumped by ClearVerdictCache, so that verdicts for requests that were in
+  // flight at the time are not cached.
+  uint32_t cache_generation_ = 0;
+
   v8::Isolate* isolate_;
   v8::Global<v8::Context> context_;
   v8::Global<v8::Object> provider_;
@@ -314,6 +314,10 @@ class SpellCheckerHolder final : public content::RenderFrameObserver {
 
   ~SpellCheckerHolder() final { instances_.erase(this); }
 
+  SpellCheckClient* spell_check_client() const {
+    return spell_check_client_.get();
+  }
+
   void UnsetAndDestroy() {
     FrameSetSpellChecker set_spell_checker(nullptr, render_frame());
     delete this;
@@ -559,6 +563,21 @@ void SetSpellCheckProvider(gin_helper::Arguments* args,
   new SpellCheckerHolder(render_frame, std::move(spell_check_client));
 }
 
+void ClearSpellCheckCache(gin_helper::ErrorThrower thrower,
+                          v8::Local<v8::Value> window) {
+  content::RenderFrame* render_frame = GetRenderFrame(window);
+  if (!render_frame) {
+    thrower.ThrowError(
+        "Render frame was torn down before webFrame.clearSpellCheckCache "
+        "could be executed");
+    return;
+  }
+
+  auto* holder = SpellCheckerHolder::FromRenderFrame(render_frame);
+  if (holder)
+    holder->spell_check_client()->ClearVerdictCache();
+}
+
 void InsertText(gin_helper::ErrorThrower thrower,
                 v8::Local<v8::Value> window,
                 const std::string& text) {
@@ -928,6 +947,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("getWebFrameId", &GetWebFrameId);
   dict.SetMethod("getWebPreference", &GetWebPreference);
   dict.SetMethod("setSpellCheckProvider", &SetSpellCheckProvider);
+  dict.SetMethod("clearSpellCheckCache", &ClearSpellCheckCache);
   dict.SetMethod("insertText", &InsertText);
   dict.SetMethod("insertCSS", &InsertCSS);
   dict.SetMethod("removeInsertedCSS", &RemoveInsertedCSS);
@@ -200,7 +200,10 @@ void ElectronApiServiceImpl::ReceivePostMessage(
 
 void ElectronApiServiceImpl::TakeHeapSnapshot(
     mojo::ScopedHandle file,
+    bool gzip,
     TakeHeapSnapshotCallback callback) {
+  // The snapshot is written from this thread whenever the background writes
+  // fall too far behind.
   base::ThreadRestrictions::ScopedAllowIO allow_io;
 
   base::ScopedPlatformFile platform_file;
@@ -210,12 +213,12 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
     std::move(callback).Run(false);
     return;
   }
-  base::File base_file(std::move(platform_file));
 
-  bool success =
-      electron::TakeHeapSnapshot(blink::MainThreadIsolate(), &base_file);
-
-  std::move(callback).Run(success);
+  electron::TakeHeapSnapshot(blink::MainThreadIsolate(),
+                             base::File(std::move(platform_file)),
+                             gzip ? HeapSnapshotCompression::kGzip
+                                  : HeapSnapshotCompression::kNone,
+                             std::move(callback));
 }
 
 }  // namespace electron
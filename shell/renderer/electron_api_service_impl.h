@@ -36,6 +36,7 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
+                        bool gzip,
                         TakeHeapSnapshotCallback callback) override;
   void ProcessPendingMessages();
 
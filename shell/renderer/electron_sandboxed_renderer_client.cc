@@ -4,12 +4,20 @@
 
 #include "shell/renderer/electron_sandboxed_renderer_client.h"
 
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "base/base_paths.h"
 #include "base/command_line.h"
+#include "base/containers/mru_cache.h"
 #include "base/files/file_path.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/process/process_handle.h"
 #include "content/public/renderer/render_frame.h"
+#include "crypto/secure_hash.h"
+#include "crypto/sha2.h"
 #include "electron/buildflags/buildflags.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/application_info.h"
@@ -84,10 +92,80 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
   return exports;
 }
 
+// Identifies a preload source by the SHA-256 digest of its contents, so that
+// the cache does not keep copies of the sources alive. V8 only checks the
+// source length before using a code cache, so a weaker hash could run the
+// code of another preload script on a collision.
+using PreloadSourceKey = std::string;
+
+PreloadSourceKey GetPreloadSourceKey(v8::Isolate* isolate,
+                                     v8::Local<v8::String> source) {
+  // Hashed in chunks to avoid copying the whole source out of V8.
+  constexpr int kChunkSize = 4096;
+  uint16_t buffer[kChunkSize];
+  const int length = source->Length();
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  for (int start = 0; start < length; start += kChunkSize) {
+    int written = source->Write(isolate, buffer, start, kChunkSize,
+                                v8::String::NO_NULL_TERMINATION);
+    hash->Update(buffer, written * sizeof(uint16_t));
+  }
+  std::string digest(crypto::kSHA256Length, '\0');
+  hash->Finish(&digest[0], digest.size());
+  return digest;
+}
+
+// V8 code caches of the preload wrappers compiled in this process. Every
+// navigation compiles the preload scripts again, mostly with unchanged
+// sources.
+using PreloadCodeCache = base::MRUCache<PreloadSourceKey, std::string>;
+
+PreloadCodeCache& GetPreloadCodeCache() {
+  constexpr size_t kMaxPreloadCodeCaches = 8;
+  static base::NoDestructor<PreloadCodeCache> cache(kMaxPreloadCodeCaches);
+  return *cache;
+}
+
 v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
                                          v8::Local<v8::String> preloadSrc) {
-  return RendererClientBase::RunScript(isolate->GetCurrentContext(),
-                                       preloadSrc);
+  auto context = isolate->GetCurrentContext();
+  const PreloadSourceKey key = GetPreloadSourceKey(isolate, preloadSrc);
+  PreloadCodeCache& code_cache = GetPreloadCodeCache();
+  auto iter = code_cache.Get(key);
+
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  if (iter != code_cache.end()) {
+    // Does not own the buffer, the cache entry outlives the compilation.
+    cached_data = new v8::ScriptCompiler::CachedData(
+        reinterpret_cast<const uint8_t*>(iter->second.data()),
+        static_cast<int>(iter->second.size()));
+  }
+  v8::ScriptCompiler::Source script_source(preloadSrc, cached_data);
+  v8::Local<v8::Script> script;
+  if (!v8::ScriptCompiler::Compile(context, &script_source,
+                                   cached_data
+                                       ? v8::ScriptCompiler::kConsumeCodeCache
+                                       : v8::ScriptCompiler::kNoCompileOptions)
+           .ToLocal(&script))
+    return v8::Local<v8::Value>();
+  bool needs_code_cache =
+      !cached_data || script_source.GetCachedData()->rejected;
+
+  v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+
+  // The wrapper is a parenthesized function, which V8 compiles eagerly, so
+  // the cache covers its body too.
+  if (needs_code_cache) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> data(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (data && data->length > 0) {
+      code_cache.Put(key,
+                     std::string(reinterpret_cast<const char*>(data->data),
+                                 data->length));
+    }
+  }
+  return result;
 }
 
 double Uptime() {
@@ -9,7 +9,7 @@ import { promisify } from 'util';
 import { app, BrowserWindow, Menu, session } from 'electron/main';
 import { emittedOnce } from './events-helpers';
 import { closeWindow, closeAllWindows } from './window-helpers';
-import { ifdescribe, ifit } from './spec-helpers';
+import { ifdescribe, ifit, delay } from './spec-helpers';
 import split = require('split')
 
 const features = process._linkedBinding('electron_common_features');
@@ -1347,6 +1347,70 @@ describe('app module', () => {
     });
   });
 
+  describe('metrics sampling API', () => {
+    afterEach(() => {
+      app.stopMetricsSampling();
+      app.removeAllListeners('metrics-threshold-exceeded');
+    });
+
+    it('rejects getMetricsHistory() when sampling has not been started', async () => {
+      await expect(app.getMetricsHistory()).to.eventually.be.rejectedWith(/has not been started/);
+    });
+
+    it('validates its options', () => {
+      expect(() => app.startMetricsSampling({ interval: 10 })).to.throw(/interval must be at least 100 milliseconds/);
+      expect(() => app.startMetricsSampling({ historySize: 0 })).to.throw(/historySize must be a positive integer/);
+    });
+
+    it('collects a bounded history of every process', async () => {
+      app.startMetricsSampling({ interval: 100, historySize: 3 });
+
+      const getBrowserHistory = async () => {
+        const history = await app.getMetricsHistory();
+        return history.find(entry => entry.type === 'Browser');
+      };
+      let browser = await getBrowserHistory();
+      while (!browser || browser.samples.length < 3) {
+        await delay(50);
+        browser = await getBrowserHistory();
+      }
+      // Once full, new samples replace the oldest ones.
+      const newest = browser.samples[2].time;
+      while (browser!.samples[2].time === newest) {
+        await delay(50);
+        browser = await getBrowserHistory();
+      }
+
+      expect(browser!.pid).to.equal(process.pid);
+      expect(browser!.samples).to.have.lengthOf(3);
+      for (const sample of browser!.samples) {
+        expect(sample.percentCPUUsage).to.be.a('number');
+        expect(sample.idleWakeupsPerSecond).to.be.a('number');
+        expect(sample.workingSetSize).to.be.greaterThan(0);
+      }
+      const times = browser!.samples.map(sample => sample.time);
+      expect(times).to.deep.equal([...times].sort((a, b) => a - b));
+
+      const [latest] = await app.getMetricsHistory({ count: 1 });
+      expect(latest.samples).to.have.lengthOf(1);
+    });
+
+    it('emits metrics-threshold-exceeded', async () => {
+      const emitted = emittedOnce(app, 'metrics-threshold-exceeded');
+      app.startMetricsSampling({ interval: 100, memoryThreshold: 1 });
+      const [, details] = await emitted;
+      expect(details.metric).to.equal('memory');
+      expect(details.threshold).to.equal(1);
+      expect(details.value).to.be.greaterThan(1);
+    });
+
+    it('discards the history when stopped', async () => {
+      app.startMetricsSampling({ interval: 100 });
+      app.stopMetricsSampling();
+      await expect(app.getMetricsHistory()).to.eventually.be.rejected();
+    });
+  });
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus();
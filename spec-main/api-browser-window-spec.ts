@@ -947,6 +947,26 @@ describe('BrowserWindow module', () => {
       });
     });
 
+    describe('BrowserWindow.setBoundsEventInterval(interval)', () => {
+      it('folds resize events within the interval into one', async () => {
+        w.setBoundsEventInterval(500);
+        const first = emittedOnce(w, 'resize');
+        w.setSize(300, 300);
+        await first;
+
+        let count = 0;
+        w.on('resize', () => { count++; });
+        const trailing = emittedOnce(w, 'resize');
+        w.setSize(310, 310);
+        w.setSize(320, 320);
+        w.setSize(330, 330);
+        await trailing;
+        await delay(100);
+        expect(count).to.equal(1);
+        expectBoundsEqual(w.getSize(), [330, 330]);
+      });
+    });
+
     describe('BrowserWindow.setContentSize(width, height)', () => {
       it('sets the content size', async () => {
         // NB. The CI server has a very small screen. Attempting to size the window
@@ -2365,6 +2385,32 @@ describe('BrowserWindow module', () => {
         await emittedOnce(ipcMain, 'process-loaded');
       });
 
+      it('runs the new contents of a preload script rewritten between loads', async () => {
+        const tmpDir = fs.mkdtempSync(path.resolve(os.tmpdir(), 'electron-spec-preload-'));
+        defer(() => fs.rmdirSync(tmpDir, { recursive: true }));
+        const preloadPath = path.join(tmpDir, 'preload.js');
+        const writePreload = (version: string) => {
+          fs.writeFileSync(preloadPath, `require('electron').ipcRenderer.send('preload-version', '${version}')`);
+        };
+
+        writePreload('first');
+        const w = new BrowserWindow({
+          show: false,
+          webPreferences: {
+            sandbox: true,
+            preload: preloadPath
+          }
+        });
+        let version = emittedOnce(ipcMain, 'preload-version');
+        w.loadURL('about:blank');
+        expect((await version)[1]).to.equal('first');
+
+        writePreload('rewritten');
+        version = emittedOnce(ipcMain, 'preload-version');
+        w.webContents.reload();
+        expect((await version)[1]).to.equal('rewritten');
+      });
+
       it('exposes "exit" event to preload script', async () => {
         const w = new BrowserWindow({
           show: false,
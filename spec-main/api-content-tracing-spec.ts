@@ -125,6 +125,43 @@ ifdescribe(!(['arm', 'arm64'].includes(process.arch)))('contentTracing', () => {
     });
   });
 
+  describe('takeSnapshot', function () {
+    this.timeout(5e3);
+
+    afterEach(async () => {
+      await contentTracing.stopRecording().catch(() => {});
+    });
+
+    it('resolves with the trace data and keeps recording', async () => {
+      await contentTracing.startRecording({
+        included_categories: ['*'],
+        recording_mode: 'record-continuously'
+      });
+      const data = await contentTracing.takeSnapshot();
+      expect(data).to.be.an.instanceOf(Buffer);
+      expect(JSON.parse(data.toString()).traceEvents).to.be.an('array');
+      const path = await contentTracing.stopRecording();
+      expect(fs.statSync(path).isFile()).to.be.true('output exists');
+    });
+
+    it('streams the trace data in chunks', async () => {
+      await contentTracing.startRecording({ included_categories: ['*'] });
+      const chunks: Buffer[] = [];
+      const data = await contentTracing.takeSnapshot({
+        keepRecording: false,
+        onChunk: (chunk) => { chunks.push(chunk); }
+      });
+      expect(data.length).to.equal(0);
+      expect(chunks).to.not.be.empty();
+      expect(JSON.parse(Buffer.concat(chunks).toString()).traceEvents).to.be.an('array');
+      await expect(contentTracing.stopRecording()).to.be.rejected();
+    });
+
+    it('rejects if no trace is happening', async () => {
+      await expect(contentTracing.takeSnapshot()).to.be.rejected();
+    });
+  });
+
   describe('captured events', () => {
     it('include V8 samples from the main process', async function () {
       // This test is flaky on macOS CI.
@@ -545,6 +545,64 @@ describe('contextBridge', () => {
         expect(result).to.deep.equal([135, 135, 135]);
       });
 
+      it('should copy large plain data in both directions', async () => {
+        await makeBindingWindow(() => {
+          const records = Array.from({ length: 10000 }, (_, i) => ({ id: i, name: `record-${i}`, tags: ['a', 'b'], nested: { even: i % 2 === 0 } }));
+          contextBridge.exposeInMainWorld('example', {
+            records,
+            withMethod: { records: records.slice(0, 100), count: () => records.length },
+            echo: (value: any) => value
+          });
+        });
+        const result = await callWithBindings((root: any) => {
+          const { records, withMethod, echo } = root.example;
+          const shared = { value: 1 };
+          const echoed = echo({ list: Array.from({ length: 100 }, (_, i) => ({ i })), a: shared, b: shared });
+          return [
+            records.length,
+            records[9999].name,
+            records[42].tags[1],
+            records[42].nested.even,
+            Object.getPrototypeOf(records[0]) === Object.prototype,
+            Object.getPrototypeOf(records[0].tags) === Array.prototype,
+            withMethod.records.length,
+            withMethod.count(),
+            echoed.list[99].i,
+            echoed.a === echoed.b
+          ];
+        });
+        expect(result).to.deep.equal([10000, 'record-9999', 'b', true, true, true, 100, 10000, 99, true]);
+      });
+
+      it('should keep symbol keys of large objects', async () => {
+        await makeBindingWindow(() => {
+          const data: any = {};
+          for (let i = 0; i < 20; i++) data[`key${i}`] = i;
+          data[Symbol.for('tagged')] = 'symbol-value';
+          contextBridge.exposeInMainWorld('example', { data });
+        });
+        const result = await callWithBindings((root: any) => {
+          return [root.example.data.key19, root.example.data[Symbol.for('tagged')]];
+        });
+        expect(result).to.deep.equal([19, 'symbol-value']);
+      });
+
+      it('should run getters of large objects only once', async () => {
+        await makeBindingWindow(() => {
+          let calls = 0;
+          const data: any = {};
+          for (let i = 0; i < 20; i++) data[`key${i}`] = i;
+          Object.defineProperty(data, 'computed', { enumerable: true, get: () => ++calls });
+          const list = Array.from({ length: 20 }, (_, i) => i);
+          Object.defineProperty(list, 0, { enumerable: true, get: () => ++calls });
+          contextBridge.exposeInMainWorld('example', { data, list, getCalls: () => calls });
+        });
+        const result = await callWithBindings((root: any) => {
+          return [root.example.data.computed, root.example.list[0], root.example.getCalls()];
+        });
+        expect(result).to.deep.equal([1, 2, 2]);
+      });
+
       it('should handle DOM elements', async () => {
         await makeBindingWindow(() => {
           contextBridge.exposeInMainWorld('example', {
@@ -431,6 +431,68 @@ describe('ipc module', () => {
         }).to.throw(/contains the source port/);
       });
 
+      it('transfers ArrayBuffers within the process', async () => {
+        const { port1, port2 } = new MessageChannelMain();
+        const buffer = new Uint8Array([1, 2, 3]).buffer;
+        port2.postMessage({ buffer }, [buffer]);
+        expect(buffer.byteLength).to.equal(0);
+        port1.start();
+        const [ev] = await emittedOnce(port1, 'message');
+        expect(Array.from(new Uint8Array(ev.data.buffer))).to.deep.equal([1, 2, 3]);
+      });
+
+      it('transfers ArrayBuffers to and from a WebContents', async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+        w.loadURL('about:blank');
+        await w.webContents.executeJavaScript(`(${function () {
+          const { ipcRenderer } = require('electron');
+          ipcRenderer.on('port', ev => {
+            const [port] = ev.ports;
+            port.onmessage = (e: MessageEvent) => {
+              const bytes = new Uint8Array(e.data);
+              bytes.reverse();
+              port.postMessage(e.data, [e.data]);
+              ipcRenderer.send('detached', e.data.byteLength);
+            };
+          });
+        }})()`);
+        const { port1, port2 } = new MessageChannelMain();
+        w.webContents.postMessage('port', null, [port2]);
+        const buffer = new Uint8Array(1024 * 1024).map((_, i) => i % 256).buffer;
+        port1.postMessage(buffer, [buffer]);
+        expect(buffer.byteLength).to.equal(0);
+        port1.start();
+        const [[ev], [, detachedLength]] = await Promise.all([
+          emittedOnce(port1, 'message'),
+          emittedOnce(ipcMain, 'detached')
+        ]);
+        expect(detachedLength).to.equal(0);
+        const received = new Uint8Array(ev.data);
+        expect(received.length).to.equal(1024 * 1024);
+        expect(received[0]).to.equal(255);
+        expect(received[received.length - 1]).to.equal(0);
+      });
+
+      it('throws when passing duplicate ArrayBuffers', () => {
+        const { port1 } = new MessageChannelMain();
+        const buffer = new ArrayBuffer(8);
+        expect(() => {
+          port1.postMessage(buffer, [buffer, buffer]);
+        }).to.throw(/duplicate/);
+        expect(buffer.byteLength).to.equal(8);
+      });
+
+      it('throws when transferring the ArrayBuffer of a pooled Buffer', () => {
+        const { port1 } = new MessageChannelMain();
+        const buffer = Buffer.from('x');
+        const other = Buffer.from('y');
+        expect(() => {
+          port1.postMessage(buffer.buffer, [buffer.buffer]);
+        }).to.throw(/untransferable/);
+        expect(buffer.buffer.byteLength).to.be.greaterThan(0);
+        expect(other.toString()).to.equal('y');
+      });
+
       describe('GC behavior', () => {
         it('is not collected while it could still receive messages', async () => {
           let trigger: Function;
@@ -173,6 +173,40 @@ describe('MenuItems', () => {
     });
   });
 
+  describe('MenuItem state in the native menu', () => {
+    it('reflects property changes made after the menu was built', () => {
+      const menu = Menu.buildFromTemplate([
+        { label: 'normal' },
+        { label: 'checkbox', type: 'checkbox' },
+        { label: 'radio 1', type: 'radio', checked: true },
+        { label: 'radio 2', type: 'radio' }
+      ]);
+      expect(menu.isEnabledAt(0)).to.be.true('enabled');
+      expect(menu.isVisibleAt(0)).to.be.true('visible');
+      menu.items[0].enabled = false;
+      menu.items[0].visible = false;
+      expect(menu.isEnabledAt(0)).to.be.false('enabled');
+      expect(menu.isVisibleAt(0)).to.be.false('visible');
+
+      expect(menu.isItemCheckedAt(1)).to.be.false('checkbox checked');
+      menu._executeCommand({}, menu.items[1].commandId);
+      expect(menu.isItemCheckedAt(1)).to.be.true('checkbox checked');
+
+      expect(menu.isItemCheckedAt(2)).to.be.true('radio 1 checked');
+      menu.items[3].checked = true;
+      expect(menu.isItemCheckedAt(2)).to.be.false('radio 1 checked');
+      expect(menu.isItemCheckedAt(3)).to.be.true('radio 2 checked');
+    });
+
+    it('reflects state in every menu an item was inserted into', () => {
+      const item = new MenuItem({ label: 'shared' });
+      const menus = [new Menu(), new Menu()];
+      menus.forEach(menu => menu.append(item));
+      item.enabled = false;
+      expect(menus.map(menu => menu.isEnabledAt(0))).to.deep.equal([false, false]);
+    });
+  });
+
   describe('MenuItem role execution', () => {
     afterEach(closeAllWindows);
     it('does not try to execute roles without a valid role property', () => {
@@ -774,6 +774,25 @@ describe('Menu module', function () {
       expect(menu.items[2].label).to.equal('3');
       expect(menu.items[3].label).to.equal('inserted');
     });
+
+    it('does not keep the menu alive through its items', async () => {
+      const item = new MenuItem({ label: 'shared', type: 'checkbox' });
+      let menu: Menu | null = new Menu();
+      menu.append(item);
+      // eslint-disable-next-line no-undef
+      const wr = new WeakRef(menu);
+      menu = null;
+
+      await delay();
+      const v8Util = process._linkedBinding('electron_common_v8_util');
+      v8Util.requestGarbageCollectionForTesting();
+      await delay();
+
+      expect(wr.deref()).to.be.undefined();
+      // Updating the item skips the collected menu.
+      item.checked = true;
+      expect(item.checked).to.be.true();
+    });
   });
 
   describe('Menu.popup', () => {
@@ -3,6 +3,7 @@ import * as http from 'http';
 import * as https from 'https';
 import * as path from 'path';
 import * as fs from 'fs';
+import * as os from 'os';
 import * as ChildProcess from 'child_process';
 import { app, session, BrowserWindow, net, ipcMain, Session } from 'electron/main';
 import * as send from 'send';
@@ -31,6 +32,40 @@ describe('session module', () => {
     });
   });
 
+  describe('session.fromPartitionAsync(partition, options)', () => {
+    it('resolves with the same session as fromPartition', async () => {
+      const ses = await session.fromPartitionAsync('persist:from-partition-async');
+      expect(ses).to.equal(session.fromPartition('persist:from-partition-async'));
+    });
+
+    it('resolves concurrent requests for a new partition with one session', async () => {
+      const partition = `persist:from-partition-async-${Date.now()}`;
+      const [a, b] = await Promise.all([
+        session.fromPartitionAsync(partition),
+        session.fromPartitionAsync(partition)
+      ]);
+      expect(a).to.equal(b);
+      expect(a.getUserAgent()).to.be.a('string');
+    });
+
+    it('resolves in-memory partitions', async () => {
+      const ses = await session.fromPartitionAsync('from-partition-async-in-memory');
+      expect(ses.isPersistent()).to.be.false();
+    });
+
+    it('does not crash when the app quits while partitions are loading', async () => {
+      const userDataDir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-spec-partitions-'));
+      defer(() => fs.rmdirSync(userDataDir, { recursive: true }));
+      const appPath = path.join(__dirname, 'fixtures', 'api', 'from-partition-async-quit.js');
+      const appProcess = ChildProcess.spawn(process.execPath, [appPath], {
+        env: { ...process.env, USER_DATA_DIR: userDataDir }
+      });
+      const [code, signal] = await emittedOnce(appProcess, 'exit');
+      expect(signal).to.equal(null);
+      expect(code).to.equal(0);
+    });
+  });
+
   describe('ses.cookies', () => {
     const name = '0';
     const value = '0';
@@ -485,11 +520,34 @@ describe('session module', () => {
     const scheme = 'cors-blob';
     const protocol = session.defaultSession.protocol;
     const url = `${scheme}://host`;
-    after(async () => {
+    afterEach(async () => {
       await protocol.unregisterProtocol(scheme);
     });
     afterEach(closeAllWindows);
 
+    const postBlob = (postData: string) => {
+      const content = `<html>
+                       <script>
+                       let fd = new FormData();
+                       fd.append('file', new Blob([${JSON.stringify(postData)}], {type:'application/octet-stream'}));
+                       fetch('${url}', {method:'POST', body: fd });
+                       </script>
+                       </html>`;
+      const uuid = new Promise<string>((resolve) => {
+        protocol.registerStringProtocol(scheme, (request, callback) => {
+          if (request.method === 'GET') {
+            callback({ data: content, mimeType: 'text/html' });
+          } else if (request.method === 'POST') {
+            resolve(request.uploadData![1].blobUUID!);
+            callback('');
+          }
+        });
+      });
+      const w = new BrowserWindow({ show: false });
+      w.loadURL(url);
+      return uuid;
+    };
+
     it('returns blob data for uuid', (done) => {
       const postData = JSON.stringify({
         type: 'blob',
@@ -526,6 +584,38 @@ describe('session module', () => {
       const w = new BrowserWindow({ show: false });
       w.loadURL(url);
     });
+
+    it('returns a range of the blob data', async () => {
+      const uuid = await postBlob('0123456789');
+      const range = await session.defaultSession.getBlobData(uuid, { offset: 2, length: 5 });
+      expect(range.toString()).to.equal('23456');
+      const tail = await session.defaultSession.getBlobData(uuid, { offset: 8, length: 100 });
+      expect(tail.toString()).to.equal('89');
+      const past = await session.defaultSession.getBlobData(uuid, { offset: 100 });
+      expect(past.length).to.equal(0);
+    });
+
+    it('rejects an invalid range', async () => {
+      const uuid = await postBlob('0123456789');
+      expect(() => {
+        session.defaultSession.getBlobData(uuid, { offset: -1 });
+      }).to.throw(/offset must be a non-negative integer/);
+    });
+
+    it('reads blob data in chunks with getBlobDataReader', async () => {
+      const postData = 'x'.repeat(200 * 1024) + 'end';
+      const uuid = await postBlob(postData);
+      const reader = session.defaultSession.getBlobDataReader(uuid, { offset: 1 });
+      const chunks: Buffer[] = [];
+      let chunk: Buffer | null;
+      while ((chunk = await reader.read()) !== null) {
+        expect(chunk.length).to.be.at.most(64 * 1024);
+        chunks.push(chunk);
+      }
+      expect(chunks.length).to.be.greaterThan(1);
+      expect(Buffer.concat(chunks).toString()).to.equal(postData.slice(1));
+      expect(await reader.read()).to.be.null();
+    });
   });
 
   describe('ses.setCertificateVerifyProc(callback)', () => {
@@ -1029,6 +1119,66 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setPermissionCheckHandler(handler)', () => {
+    afterEach(closeAllWindows);
+    afterEach(() => {
+      session.defaultSession.setPermissionCheckHandler(null);
+    });
+
+    const queryPermission = (w: BrowserWindow) => w.webContents.executeJavaScript(
+      'navigator.permissions.query({ name: \'geolocation\' }).then(status => status.state)');
+
+    it('reuses verdicts returned with a cacheTTL', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      let calls = 0;
+      session.defaultSession.setPermissionCheckHandler((webContents, permission) => {
+        if (permission !== 'geolocation') return false;
+        calls++;
+        return { granted: false, cacheTTL: 60 * 1000 };
+      });
+      expect(await queryPermission(w)).to.equal('denied');
+      expect(await queryPermission(w)).to.equal('denied');
+      expect(calls).to.equal(1);
+
+      session.defaultSession.clearPermissionCheckCache();
+      expect(await queryPermission(w)).to.equal('denied');
+      expect(calls).to.equal(2);
+    });
+
+    it('calls the handler for every check when no cacheTTL is returned', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      let calls = 0;
+      session.defaultSession.setPermissionCheckHandler((webContents, permission) => {
+        if (permission === 'geolocation') calls++;
+        return false;
+      });
+      await queryPermission(w);
+      await queryPermission(w);
+      expect(calls).to.equal(2);
+    });
+
+    it('does not share cached verdicts between webContents', async () => {
+      const w1 = new BrowserWindow({ show: false });
+      const w2 = new BrowserWindow({ show: false });
+      await w1.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      await w2.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      session.defaultSession.setPermissionCheckHandler((webContents, permission) => {
+        return { granted: permission === 'geolocation' && webContents === w1.webContents, cacheTTL: 60 * 1000 };
+      });
+      expect(await queryPermission(w1)).to.equal('granted');
+      expect(await queryPermission(w2)).to.equal('denied');
+    });
+
+    it('treats other truthy return values as granted', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      session.defaultSession.setPermissionCheckHandler((async () => false) as any);
+      expect(await queryPermission(w)).to.equal('granted');
+    });
+  });
+
   describe('ses.isPersistent()', () => {
     afterEach(closeAllWindows);
 
@@ -1053,6 +1203,48 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.warmUpRendererProcess()', () => {
+    afterEach(closeAllWindows);
+
+    const rendererPids = () => app.getAppMetrics().filter(m => m.type === 'Tab').map(m => m.pid);
+
+    // Returns the pid of the spare once it has launched.
+    const warmUp = async (ses: Session) => {
+      const existing = rendererPids();
+      ses.warmUpRendererProcess();
+      for (;;) {
+        const pid = rendererPids().find(pid => !existing.includes(pid));
+        if (pid !== undefined) return pid;
+        await delay(50);
+      }
+    };
+
+    it('is used by a sandboxed window', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      const sparePid = await warmUp(ses);
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      expect(w.webContents.getOSProcessId()).to.equal(sparePid);
+    });
+
+    it('is not used by a window without sandbox', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      const sparePid = await warmUp(ses);
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: false } });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      expect(w.webContents.getOSProcessId()).to.not.equal(sparePid);
+    });
+
+    it('is not used by a window with node integration', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      const sparePid = await warmUp(ses);
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, nodeIntegration: true, contextIsolation: false } });
+      await w.loadFile(path.join(fixtures, 'api', 'blank.html'));
+      expect(w.webContents.getOSProcessId()).to.not.equal(sparePid);
+      expect(await w.webContents.executeJavaScript('typeof require')).to.equal('function');
+    });
+  });
+
   describe('ses.setUserAgent()', () => {
     afterEach(closeAllWindows);
 
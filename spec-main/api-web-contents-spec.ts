@@ -3,7 +3,8 @@ import { AddressInfo } from 'net';
 import * as path from 'path';
 import * as fs from 'fs';
 import * as http from 'http';
-import { BrowserWindow, ipcMain, webContents, session, WebContents, app } from 'electron/main';
+import * as zlib from 'zlib';
+import { BrowserWindow, ipcMain, webContents, session, WebContents, app, net } from 'electron/main';
 import { clipboard } from 'electron/common';
 import { emittedOnce } from './events-helpers';
 import { closeAllWindows } from './window-helpers';
@@ -192,6 +193,71 @@ describe('webContents module', () => {
     });
   });
 
+  describe('history.length with renderer process reuse disabled', () => {
+    before(() => {
+      app.allowRendererProcessReuse = false;
+    });
+    after(() => {
+      app.allowRendererProcessReuse = true;
+    });
+    afterEach(closeAllWindows);
+
+    const historyLength = (w: BrowserWindow) => w.webContents.executeJavaScript('history.length');
+
+    it('counts entries added by pushState()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(await w.webContents.executeJavaScript('history.pushState({}, \'\'); history.length')).to.equal(2);
+      expect(await w.webContents.executeJavaScript('history.pushState({}, \'\', \'#a\'); history.length')).to.equal(3);
+      await delay(100);
+      expect(await historyLength(w)).to.equal(3);
+    });
+
+    it('keeps the count across back-to-back pushState() and replaceState() calls', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(await w.webContents.executeJavaScript(
+        'history.pushState({}, \'\'); history.pushState({}, \'\'); history.replaceState({}, \'\', \'#r\'); history.length')).to.equal(3);
+      await delay(100);
+      expect(await historyLength(w)).to.equal(3);
+      expect((w.webContents as any).length()).to.equal(3);
+    });
+
+    it('counts entries added by hash navigations', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(await w.webContents.executeJavaScript('location.hash = \'a\'; history.length')).to.equal(2);
+      await w.webContents.executeJavaScript('new Promise(resolve => { window.onhashchange = resolve; location.hash = \'b\'; })');
+      expect(await historyLength(w)).to.equal(3);
+      await delay(100);
+      expect(await historyLength(w)).to.equal(3);
+    });
+
+    it('keeps forward entries after goBack() and drops them on navigation', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'a.html'));
+      await w.loadFile(path.join(fixturesPath, 'pages', 'b.html'));
+      const finished = emittedOnce(w.webContents, 'did-finish-load');
+      w.webContents.goBack();
+      await finished;
+      expect(await historyLength(w)).to.equal(2);
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(await historyLength(w)).to.equal(2);
+    });
+
+    it('follows clearHistory()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'a.html'));
+      await w.loadFile(path.join(fixturesPath, 'pages', 'b.html'));
+      expect(await historyLength(w)).to.equal(2);
+      w.webContents.clearHistory();
+      // The browser-side history is emptied, including the current entry.
+      expect(await historyLength(w)).to.equal(0);
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      expect(await historyLength(w)).to.equal(1);
+    });
+  });
+
   describe('webContents.executeJavaScript', () => {
     describe('in about:blank', () => {
       const expected = 'hello, world!';
@@ -1427,6 +1493,63 @@ describe('webContents module', () => {
     });
   });
 
+  describe('native events', () => {
+    afterEach(closeAllWindows);
+
+    const nextConsoleMessage = (w: BrowserWindow, expected: string) => {
+      return new Promise<void>((resolve) => {
+        w.webContents.on('console-message', (e, level, message) => {
+          if (message === expected) resolve();
+        });
+      });
+    };
+
+    it('reach listeners added after an event was emitted without any', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript('console.log("unheard")');
+      const heard = nextConsoleMessage(w, 'heard');
+      w.webContents.executeJavaScript('console.log("heard")');
+      await heard;
+    });
+
+    it('reach objects that override emit()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const emitted = new Promise<string>((resolve) => {
+        const { emit } = w.webContents;
+        (w.webContents as any).emit = function (this: WebContents, name: string, ...args: any[]) {
+          if (name === 'console-message') resolve(args[2]);
+          return emit.call(this, name, ...args);
+        };
+      });
+      w.webContents.executeJavaScript('console.log("overridden")');
+      expect(await emitted).to.equal('overridden');
+    });
+
+    it('reach once() listeners', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const message = new Promise<string>((resolve) => {
+        w.webContents.once('console-message', (e, level, message) => resolve(message));
+      });
+      w.webContents.executeJavaScript('console.log("once")');
+      expect(await message).to.equal('once');
+      expect(w.webContents.listenerCount('console-message')).to.equal(0);
+      const again = nextConsoleMessage(w, 'again');
+      w.webContents.executeJavaScript('console.log("again")');
+      await again;
+    });
+
+    it("always emits 'error'", async () => {
+      const request = net.request('http://127.0.0.1:1');
+      const error = emittedOnce(request, 'error');
+      request.end();
+      const [err] = await error;
+      expect(err).to.be.an.instanceOf(Error);
+    });
+  });
+
   describe('ipc-message event', () => {
     afterEach(closeAllWindows);
     it('emits when the renderer process sends an asynchronous message', async () => {
@@ -1632,6 +1755,27 @@ describe('webContents module', () => {
       }
     });
 
+    it('writes a gzipped snapshot', async () => {
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          sandbox: true
+        }
+      });
+
+      await w.loadURL('about:blank');
+
+      const filePath = path.join(app.getPath('temp'), 'test.heapsnapshot.gz');
+
+      try {
+        await w.webContents.takeHeapSnapshot(filePath, { compression: 'gzip' });
+        const snapshot = JSON.parse(zlib.gunzipSync(fs.readFileSync(filePath)).toString());
+        expect(snapshot).to.have.property('snapshot');
+      } finally {
+        fs.rmSync(filePath, { force: true });
+      }
+    });
+
     it('fails with invalid file path', async () => {
       const w = new BrowserWindow({
         show: false,
@@ -1729,7 +1873,8 @@ describe('webContents module', () => {
         headerFooter: '123',
         printSelectionOnly: 1,
         printBackground: 2,
-        pageSize: 'IAmAPageSize'
+        pageSize: 'IAmAPageSize',
+        path: 42
       };
 
       // These will hard crash in Chromium unless we type-check
@@ -1744,6 +1889,26 @@ describe('webContents module', () => {
       expect(data).to.be.an.instanceof(Buffer).that.is.not.empty();
     });
 
+    it('can print to PDF and write the file directly', async () => {
+      const pdfPath = path.join(app.getPath('temp'), `print-to-pdf-${Date.now()}.pdf`);
+      defer(() => fs.rmSync(pdfPath, { force: true }));
+      const data = await w.webContents.printToPDF({ path: pdfPath });
+      expect(data).to.be.an.instanceof(Buffer).that.is.empty();
+      const written = fs.readFileSync(pdfPath);
+      expect(written.slice(0, 5).toString()).to.equal('%PDF-');
+    });
+
+    it('rejects when the file cannot be written', async () => {
+      const pdfPath = path.join(app.getPath('temp'), 'does-not-exist', `${Date.now()}`, 'out.pdf');
+      await expect(w.webContents.printToPDF({ path: pdfPath })).to.eventually.be.rejectedWith(/Failed to write PDF/);
+    });
+
+    it('returns a writable Buffer', async () => {
+      const data = await w.webContents.printToPDF({});
+      data[0] = 0;
+      expect(data[0]).to.equal(0);
+    });
+
     it('does not crash when called multiple times in parallel', async () => {
       const promises = [];
       for (let i = 0; i < 3; i++) {
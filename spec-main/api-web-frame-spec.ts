@@ -44,34 +44,63 @@ describe('webFrame module', () => {
     expect(error).to.have.property('message', 'Uncaught Error: An object could not be cloned.');
   });
 
-  it('calls a spellcheck provider', async () => {
-    const w = new BrowserWindow({
-      show: false,
-      webPreferences: {
-        nodeIntegration: true,
-        contextIsolation: false
-      }
+  describe('spellcheck provider', () => {
+    let w: BrowserWindow;
+    beforeEach(async () => {
+      w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          nodeIntegration: true,
+          contextIsolation: false
+        }
+      });
+      await w.loadFile(path.join(fixtures, 'pages', 'webframe-spell-check.html'));
+      w.focus();
+      await w.webContents.executeJavaScript('document.querySelector("input").focus()', true);
+    });
+    afterEach(() => {
+      ipcMain.removeAllListeners('spec-spell-check');
     });
-    await w.loadFile(path.join(fixtures, 'pages', 'webframe-spell-check.html'));
-    w.focus();
-    await w.webContents.executeJavaScript('document.querySelector("input").focus()', true);
 
-    const spellCheckerFeedback =
+    // The API calls the provider after every completed word, passing only
+    // the words it has not seen before. Resolves once |count| distinct words
+    // have been checked.
+    const collectSpellCheckedWords = (count: number) =>
       new Promise<[string[], boolean]>(resolve => {
+        const checked: string[] = [];
         ipcMain.on('spec-spell-check', (e, words, callbackDefined) => {
-          if (words.length === 5) {
-            // The API calls the provider after every completed word.
-            // The promise is resolved only after this event is received with all words.
-            resolve([words, callbackDefined]);
+          checked.push(...words);
+          if (new Set(checked).size === count) {
+            resolve([checked, callbackDefined]);
           }
         });
       });
-    const inputText = 'spleling test you\'re ';
-    for (const keyCode of inputText) {
-      w.webContents.sendInputEvent({ type: 'char', keyCode });
-    }
-    const [words, callbackDefined] = await spellCheckerFeedback;
-    expect(words.sort()).to.deep.equal(['spleling', 'test', 'you\'re', 'you', 're'].sort());
-    expect(callbackDefined).to.be.true();
+
+    const typeText = (text: string) => {
+      for (const keyCode of text) {
+        w.webContents.sendInputEvent({ type: 'char', keyCode });
+      }
+    };
+
+    it('calls a spellcheck provider', async () => {
+      const spellCheckerFeedback = collectSpellCheckedWords(5);
+      typeText('spleling test you\'re ');
+      const [words, callbackDefined] = await spellCheckerFeedback;
+      expect(words.sort()).to.deep.equal(['spleling', 'test', 'you\'re', 'you', 're'].sort());
+      expect(callbackDefined).to.be.true();
+    });
+
+    it('checks the cached words again after clearSpellCheckCache()', async () => {
+      const firstFeedback = collectSpellCheckedWords(2);
+      typeText('spleling test ');
+      await firstFeedback;
+      ipcMain.removeAllListeners('spec-spell-check');
+
+      await w.webContents.executeJavaScript('require("electron").webFrame.clearSpellCheckCache()');
+      const secondFeedback = collectSpellCheckedWords(3);
+      typeText('again ');
+      const [words] = await secondFeedback;
+      expect(words.sort()).to.deep.equal(['again', 'spleling', 'test']);
+    });
   });
 });
@@ -0,0 +1,11 @@
+const { app, session } = require('electron');
+
+app.setPath('userData', process.env.USER_DATA_DIR);
+
+app.whenReady().then(() => {
+  // Quit while the preferences of these partitions are still being read.
+  for (let i = 0; i < 20; i++) {
+    session.fromPartitionAsync(`persist:pending-${i}`);
+  }
+  app.quit();
+});
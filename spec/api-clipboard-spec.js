@@ -32,6 +32,27 @@ describe('clipboard module', () => {
     });
   });
 
+  describe('clipboard.promises', () => {
+    it('is not an enumerable clipboard method', () => {
+      expect(Object.keys(clipboard)).to.not.include('promises');
+    });
+
+    it('reads and writes asynchronously', async () => {
+      const text = 'async clipboard text';
+      await clipboard.promises.writeText(text);
+      expect(await clipboard.promises.readText()).to.equal(text);
+      expect(clipboard.readText()).to.equal(text);
+    });
+
+    it('returns NativeImage instances', async () => {
+      const p = path.join(fixtures, 'assets', 'logo.png');
+      const i = nativeImage.createFromPath(p);
+      await clipboard.promises.writeImage(i);
+      const readImage = await clipboard.promises.readImage();
+      expect(readImage.toDataURL()).to.equal(i.toDataURL());
+    });
+  });
+
   describe('clipboard.readHTML()', () => {
     it('returns markup correctly', () => {
       const text = '<string>Hi</string>';
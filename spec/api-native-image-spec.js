@@ -236,6 +236,29 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('createFromBufferAsync(buffer, options)', () => {
+    it('resolves with an empty image when the buffer is empty', async () => {
+      const image = await nativeImage.createFromBufferAsync(Buffer.from([]));
+      expect(image.isEmpty()).to.be.true();
+    });
+
+    it('resolves with an image created from the given buffer', async () => {
+      const imageA = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+
+      const imageB = await nativeImage.createFromBufferAsync(imageA.toPNG());
+      expect(imageB.getSize()).to.deep.equal({ width: 538, height: 190 });
+      expect(imageA.toBitmap().equals(imageB.toBitmap())).to.be.true();
+
+      const imageC = await nativeImage.createFromBufferAsync(imageA.toBitmap(),
+        { width: 538, height: 190, scaleFactor: 2.0 });
+      expect(imageC.getSize()).to.deep.equal({ width: 269, height: 95 });
+    });
+
+    it('rejects on invalid arguments', async () => {
+      await expect(nativeImage.createFromBufferAsync(null)).to.eventually.be.rejectedWith('buffer must be a node Buffer');
+    });
+  });
+
   describe('createFromDataURL(dataURL)', () => {
     it('returns an empty image from the empty string', () => {
       expect(nativeImage.createFromDataURL('').isEmpty()).to.be.true();
@@ -389,6 +412,30 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('createFromPathAsync(path)', () => {
+    it('resolves with an empty image for invalid paths', async () => {
+      expect((await nativeImage.createFromPathAsync('')).isEmpty()).to.be.true();
+      expect((await nativeImage.createFromPathAsync('does-not-exist.png')).isEmpty()).to.be.true();
+      expect((await nativeImage.createFromPathAsync(__dirname)).isEmpty()).to.be.true();
+      expect((await nativeImage.createFromPathAsync(__filename)).isEmpty()).to.be.true();
+    });
+
+    it('loads the same image as createFromPath', async () => {
+      const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+      const imageA = nativeImage.createFromPath(imagePath);
+      const imageB = await nativeImage.createFromPathAsync(imagePath);
+      expect(imageB.isEmpty()).to.be.false();
+      expect(imageB.getSize()).to.deep.equal({ width: 538, height: 190 });
+      expect(imageA.toBitmap().equals(imageB.toBitmap())).to.be.true();
+    });
+
+    it('loads images from paths with `..` segments', async () => {
+      const imagePath = `${path.join(__dirname, 'fixtures', 'api')}${path.sep}..${path.sep}${path.join('assets', 'logo.png')}`;
+      const image = await nativeImage.createFromPathAsync(imagePath);
+      expect(image.getSize()).to.deep.equal({ width: 538, height: 190 });
+    });
+  });
+
   describe('createFromNamedImage(name)', () => {
     it('returns empty for invalid options', () => {
       const image = nativeImage.createFromNamedImage('totally_not_real');
@@ -476,6 +523,55 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('resizeAsync(options)', () => {
+    it('resolves with a resized image', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      const resized = await image.resizeAsync({ width: 269 });
+      expect(resized.getSize()).to.deep.equal({ width: 269, height: 95 });
+    });
+
+    it('crops before resizing', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      const resized = await image.resizeAsync({ crop: { x: 0, y: 0, width: 200, height: 100 }, width: 100 });
+      expect(resized.getSize()).to.deep.equal({ width: 100, height: 50 });
+    });
+
+    it('resolves with an empty image when called on an empty image', async () => {
+      const image = await nativeImage.createEmpty().resizeAsync({ width: 1, height: 1 });
+      expect(image.isEmpty()).to.be.true();
+    });
+  });
+
+  describe('encodeAsync(options)', () => {
+    it('resolves with the same PNG data as toPNG()', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      const encoded = await image.encodeAsync({ format: 'png' });
+      const decoded = nativeImage.createFromBuffer(encoded);
+      expect(decoded.toBitmap().equals(image.toBitmap())).to.be.true();
+    });
+
+    it('encodes JPEG and WebP data', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      const jpeg = await image.encodeAsync({ format: 'jpeg', quality: 80 });
+      expect(nativeImage.createFromBuffer(jpeg).getSize()).to.deep.equal({ width: 538, height: 190 });
+      const webp = await image.encodeAsync({ format: 'webp' });
+      expect(webp.slice(8, 12).toString()).to.equal('WEBP');
+    });
+
+    it('rejects unsupported formats', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      await expect(image.encodeAsync({ format: 'gif' })).to.eventually.be.rejectedWith("Unsupported image format 'gif'");
+    });
+  });
+
+  describe('toBitmapAsync()', () => {
+    it('resolves with the same data as toBitmap()', async () => {
+      const image = nativeImage.createFromPath(path.join(__dirname, 'fixtures', 'assets', 'logo.png'));
+      const bitmap = await image.toBitmapAsync();
+      expect(bitmap.equals(image.toBitmap())).to.be.true();
+    });
+  });
+
   describe('getAspectRatio()', () => {
     it('returns an aspect ratio of an empty image', () => {
       expect(nativeImage.createEmpty().getAspectRatio()).to.equal(1.0);
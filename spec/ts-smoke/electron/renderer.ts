@@ -69,6 +69,8 @@ webFrame.setSpellCheckProvider('en-US', {
   }
 })
 
+webFrame.clearSpellCheckCache()
+
 webFrame.insertText('text')
 
 webFrame.executeJavaScript('return true;').then((v: boolean) => console.log(v))
@@ -75,13 +75,14 @@ declare namespace Electron {
     _send(internal: boolean, channel: string, args: any): boolean;
     _sendToFrameInternal(frameId: number | [number, number], channel: string, ...args: any[]): boolean;
     _sendInternal(channel: string, ...args: any[]): void;
-    _printToPDF(options: any): Promise<Buffer>;
+    _printToPDF(options: any, path?: string): Promise<Buffer>;
     _print(options: any, callback?: (success: boolean, failureReason: string) => void): void;
     _getPrinters(): Electron.PrinterInfo[];
     _init(): void;
     canGoToIndex(index: number): boolean;
     getActiveIndex(): number;
     length(): number;
+    _getNavigationState(): ElectronInternal.NavigationState;
     destroy(): void;
     // <webview>
     attachToIframe(embedderWebContents: Electron.WebContents, embedderFrameId: number): void;
@@ -115,20 +116,17 @@ declare namespace Electron {
   interface Menu {
     _init(): void;
     _isCommandIdChecked(id: string): boolean;
-    _isCommandIdEnabled(id: string): boolean;
-    _shouldCommandIdWorkWhenHidden(id: string): boolean;
-    _isCommandIdVisible(id: string): boolean;
-    _getAcceleratorForCommandId(id: string, useDefaultAccelerator: boolean): Accelerator | undefined;
-    _shouldRegisterAcceleratorForCommandId(id: string): boolean;
+    _setItemState(commandId: number, changes: Record<string, any>): void;
     _getSharingItemForCommandId(id: string): SharingItem | null;
     _callMenuWillShow(): void;
     _executeCommand(event: any, id: number): void;
     _menuWillShow(): void;
     commandsMap: Record<string, MenuItem>;
-    groupsMap: Record<string, {
-      checked: boolean;
-    }[]>;
+    groupsMap: Record<string, MenuItem[]>;
     getItemCount(): number;
+    isItemCheckedAt(index: number): boolean;
+    isEnabledAt(index: number): boolean;
+    isVisibleAt(index: number): boolean;
     popupAt(window: BaseWindow, x: number, y: number, positioning: number, callback: () => void): void;
     closePopupAt(id: number): void;
     setSublabel(index: number, label: string): void;
@@ -149,6 +147,7 @@ declare namespace Electron {
     groupId: number;
     getDefaultRoleAccelerator(): Accelerator | undefined;
     getCheckStatus(): boolean;
+    hasDynamicCheckStatus(): boolean;
     acceleratorWorksWhenHidden?: boolean;
   }
 
@@ -208,6 +207,13 @@ declare namespace Electron {
 }
 
 declare namespace ElectronInternal {
+  interface NavigationState {
+    length: number;
+    index: number;
+    url: string | undefined;
+    sequence: number;
+  }
+
   type DeprecationHandler = (message: string) => void;
   interface DeprecationUtil {
     warnOnce(oldName: string, newName?: string): () => void;